@@ -1,31 +1,11 @@
-QT       += core gui
+TEMPLATE = subdirs
 
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+# The document core is a widget-free static library, so that it can run headless.
+# The editor and the benchmarks both link against it.
+SUBDIRS += \
+    core \
+    editor \
+    benchmarks
 
-CONFIG += c++17
-
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-
-SOURCES += \
-    colorpicker.cpp \
-    main.cpp \
-    spriteedit.cpp \
-    spriteeditormodel.cpp \
-    spriteeditorview.cpp
-
-HEADERS += \
-    colorpicker.h \
-    spriteedit.h \
-    spriteeditormodel.h \
-    spriteeditorview.h
-
-FORMS += \
-    colorpicker.ui \
-    spriteeditorview.ui
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
+editor.depends = core
+benchmarks.depends = core
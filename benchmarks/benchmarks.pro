@@ -0,0 +1,37 @@
+QT       += core gui testlib
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = spriteeditor_benchmarks
+
+include(../core/core.pri)
+
+INCLUDEPATH += ../editor
+
+SOURCES += \
+    spriteeditorbenchmarks.cpp \
+    ../editor/canvaswidget.cpp \
+    ../editor/colorpicker.cpp \
+    ../editor/framelistmodel.cpp \
+    ../editor/framethumbnaildelegate.cpp \
+    ../editor/inputrecorder.cpp \
+    ../editor/palettelistmodel.cpp \
+    ../editor/performancehud.cpp \
+    ../editor/spriteeditorview.cpp
+
+HEADERS += \
+    ../editor/canvaswidget.h \
+    ../editor/colorpicker.h \
+    ../editor/framelistmodel.h \
+    ../editor/framethumbnaildelegate.h \
+    ../editor/inputrecorder.h \
+    ../editor/palettelistmodel.h \
+    ../editor/performancehud.h \
+    ../editor/spriteeditorview.h
+
+FORMS += \
+    ../editor/colorpicker.ui \
+    ../editor/spriteeditorview.ui
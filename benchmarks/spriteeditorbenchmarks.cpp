@@ -0,0 +1,606 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the microbenchmarks for the hot paths of the model and view.
+ * Unless an output is given on the command line, results are written to the console
+ * and to benchmark_results.xml, so that they can be compared between releases.
+ */
+
+
+#include "inputrecorder.h"
+#include "spriteeditormodel.h"
+#include "spriteeditorview.h"
+#include <QApplication>
+#include <QRandomGenerator>
+#include <QTemporaryDir>
+#include <QtMath>
+#include <QtTest>
+
+
+/**
+ * @brief The SpriteEditorBenchmarks class
+ * QtTest benchmarks covering file I/O, undo/redo, edit bookkeeping, drawing, the preview,
+ * and replayed strokes from input to repaint.
+ */
+class SpriteEditorBenchmarks : public QObject
+{
+    Q_OBJECT
+
+private:
+    QTemporaryDir tempDir;
+
+    void addCanvasData();
+    void fillWithNoise(SpriteEditorModel&, int, int);
+
+private slots:
+    void saveFile_data();
+    void saveFile();
+    void openFile_data();
+    void openFile();
+    void saveCompressedFile_data();
+    void saveCompressedFile();
+    void openCompressedFile_data();
+    void openCompressedFile();
+    void undoRedo_data();
+    void undoRedo();
+    void adjustEditsUpFromIndex_data();
+    void adjustEditsUpFromIndex();
+    void drawPixel_data();
+    void drawPixel();
+    void paintSelectedFrames_data();
+    void paintSelectedFrames();
+    void previewFrame_data();
+    void previewFrame();
+    void previewHeldFrames_data();
+    void previewHeldFrames();
+    void replaceColors_data();
+    void replaceColors();
+    void reduceColors_data();
+    void reduceColors();
+    void moveSelection_data();
+    void moveSelection();
+    void replayStroke_data();
+    void replayStroke();
+};
+
+
+/**
+ * @brief SpriteEditorBenchmarks::addCanvasData
+ * Adds the canvas size and frame count columns, with a row for each combination measured.
+ */
+void SpriteEditorBenchmarks::addCanvasData()
+{
+    QTest::addColumn<int>("canvasSize");
+    QTest::addColumn<int>("frameCount");
+
+    for (int canvasSize : {16, 32, 64})
+        for (int frameCount : {1, 10, 100})
+            QTest::addRow("%dpx, %d frames", canvasSize, frameCount) << canvasSize << frameCount;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::fillWithNoise
+ * Resets the model to the given number of frames, each filled with random pixels, and
+ * counts their colors. The generator is seeded, so every run measures the same content.
+ *
+ * @param model -- the model to fill
+ * @param canvasSize -- the canvas size to use
+ * @param frameCount -- the number of frames to create
+ */
+void SpriteEditorBenchmarks::fillWithNoise(SpriteEditorModel& model, int canvasSize, int frameCount)
+{
+    QRandomGenerator generator(3505);
+    QList<QImage> noiseFrames;
+    for (int i = 0; i < frameCount; i++)
+    {
+        QImage frame(canvasSize, canvasSize, QImage::Format_ARGB32);
+        for (int y = 0; y < canvasSize; y++)
+            for (int x = 0; x < canvasSize; x++)
+                frame.setPixel(x, y, generator.generate());
+        noiseFrames.append(frame);
+    }
+
+    // A new file always starts with a blank frame, which the noise frames then replace.
+    model.newFile(canvasSize);
+    model.appendFrames(noiseFrames);
+    model.selectFrame(0);
+    model.deleteCurrentFrame();
+}
+
+
+// ===================================================
+// ===              FILE MANIPULATION              ===
+// ===================================================
+
+void SpriteEditorBenchmarks::saveFile_data()
+{
+    addCanvasData();
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::saveFile
+ * Measures serializing and writing a document.
+ */
+void SpriteEditorBenchmarks::saveFile()
+{
+    QFETCH(int, canvasSize);
+    QFETCH(int, frameCount);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, canvasSize, frameCount);
+    QString fileDir = tempDir.filePath("save.ssp");
+
+    QBENCHMARK {
+        model.saveFile(fileDir);
+    }
+}
+
+void SpriteEditorBenchmarks::openFile_data()
+{
+    addCanvasData();
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::openFile
+ * Measures reading and deserializing a document.
+ */
+void SpriteEditorBenchmarks::openFile()
+{
+    QFETCH(int, canvasSize);
+    QFETCH(int, frameCount);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, canvasSize, frameCount);
+    QString fileDir = tempDir.filePath("open.ssp");
+    model.saveFile(fileDir);
+    QImage lastFrame = *model.getFrame(frameCount - 1);
+
+    QBENCHMARK {
+        model.openFile(fileDir);
+    }
+    QCOMPARE(model.getFrameCount(), frameCount);
+    QCOMPARE(*model.getFrame(frameCount - 1), lastFrame);
+}
+
+void SpriteEditorBenchmarks::saveCompressedFile_data()
+{
+    addCanvasData();
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::saveCompressedFile
+ * Measures compressing and writing a document in the binary format.
+ */
+void SpriteEditorBenchmarks::saveCompressedFile()
+{
+    QFETCH(int, canvasSize);
+    QFETCH(int, frameCount);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, canvasSize, frameCount);
+    QString fileDir = tempDir.filePath("save.sspz");
+
+    QBENCHMARK {
+        model.saveFile(fileDir);
+    }
+}
+
+void SpriteEditorBenchmarks::openCompressedFile_data()
+{
+    addCanvasData();
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::openCompressedFile
+ * Measures reading and decompressing a document in the binary format.
+ */
+void SpriteEditorBenchmarks::openCompressedFile()
+{
+    QFETCH(int, canvasSize);
+    QFETCH(int, frameCount);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, canvasSize, frameCount);
+    QString fileDir = tempDir.filePath("open.sspz");
+    model.saveFile(fileDir);
+    QImage lastFrame = *model.getFrame(frameCount - 1);
+
+    QBENCHMARK {
+        model.openFile(fileDir);
+    }
+    QCOMPARE(model.getFrameCount(), frameCount);
+    QCOMPARE(*model.getFrame(frameCount - 1), lastFrame);
+}
+
+
+// ===================================================
+// ===              EDIT MANIPULATION              ===
+// ===================================================
+
+void SpriteEditorBenchmarks::undoRedo_data()
+{
+    QTest::addColumn<int>("canvasSize");
+
+    for (int canvasSize : {16, 32, 64, 128})
+        QTest::addRow("%d pixel edit", canvasSize * canvasSize) << canvasSize;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::undoRedo
+ * Measures undoing and redoing an edit that touches every pixel of a frame.
+ */
+void SpriteEditorBenchmarks::undoRedo()
+{
+    QFETCH(int, canvasSize);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, canvasSize, 1);
+
+    QImage* frame = model.getFrame(0);
+    model.beginEdit();
+    for (int y = 0; y < canvasSize; y++)
+    {
+        for (int x = 0; x < canvasSize; x++)
+        {
+            QColor oldColor = frame->pixelColor(x, y);
+            QColor newColor = QColor::fromRgba(~oldColor.rgba());
+            model.addToEdit(QPoint(x, y), oldColor, newColor);
+            frame->setPixel(x, y, newColor.rgba());
+        }
+    }
+    model.endEdit();
+
+    QBENCHMARK {
+        model.undo();
+        model.redo();
+    }
+}
+
+void SpriteEditorBenchmarks::adjustEditsUpFromIndex_data()
+{
+    QTest::addColumn<int>("historyDepth");
+
+    for (int historyDepth : {100, 1000, 10000})
+        QTest::addRow("%d edits", historyDepth) << historyDepth;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::adjustEditsUpFromIndex
+ * Measures adding a frame to a document with a deep edit history, which shifts the frame
+ * indices of every edit.
+ */
+void SpriteEditorBenchmarks::adjustEditsUpFromIndex()
+{
+    QFETCH(int, historyDepth);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, 16, 1);
+    for (int i = 0; i < historyDepth; i++)
+    {
+        model.beginEdit();
+        model.addToEdit(QPoint(i % 16, (i / 16) % 16), Qt::transparent, Qt::black);
+        model.endEdit();
+    }
+
+    QBENCHMARK {
+        model.createNewFrame();
+    }
+}
+
+
+// ===================================================
+// ===                   DRAWING                   ===
+// ===================================================
+
+void SpriteEditorBenchmarks::drawPixel_data()
+{
+    QTest::addColumn<int>("canvasSize");
+
+    for (int canvasSize : {16, 32, 64, 128})
+        QTest::addRow("%dpx", canvasSize) << canvasSize;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::drawPixel
+ * Measures drawing a single pixel through the stroke pipeline: queueing it for the worker,
+ * waiting for it to be drawn, and swapping it into the frame, which includes invalidating
+ * the frame's thumbnail and refreshing the canvas.
+ */
+void SpriteEditorBenchmarks::drawPixel()
+{
+    QFETCH(int, canvasSize);
+
+    SpriteEditorModel model;
+    SpriteEditorView view(model);
+    model.newFile(canvasSize);
+
+    // Alternate between two colors so that every call actually changes a pixel.
+    QColor colors[2] = {Qt::black, Qt::white};
+    int drawCount = 0;
+
+    model.beginEdit();
+    view.strokeRenderer->beginStroke(*model.getFrame(0));
+    QBENCHMARK {
+        QPoint pixel(drawCount % canvasSize, (drawCount / canvasSize) % canvasSize);
+        view.strokeRenderer->addPixel(pixel, colors[(drawCount / (canvasSize * canvasSize)) % 2].rgba());
+        view.strokeRenderer->flush();
+        view.swapInStroke();
+        drawCount++;
+    }
+    view.strokeRenderer->endStroke();
+    model.endEdit();
+}
+
+void SpriteEditorBenchmarks::paintSelectedFrames_data()
+{
+    addCanvasData();
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::paintSelectedFrames
+ * Measures drawing a single pixel on every frame at once, as when painting on selected
+ * frames, then recording the painted region of each frame when the edit ends.
+ */
+void SpriteEditorBenchmarks::paintSelectedFrames()
+{
+    QFETCH(int, canvasSize);
+    QFETCH(int, frameCount);
+
+    SpriteEditorModel model;
+    SpriteEditorView view(model);
+    fillWithNoise(model, canvasSize, frameCount);
+
+    QList<int> frameIndices;
+    for (int i = 0; i < frameCount; i++)
+        frameIndices.append(i);
+
+    // Alternate between two colors so that every call actually changes a pixel.
+    QColor colors[2] = {Qt::black, Qt::white};
+    int drawCount = 0;
+
+    model.beginEdit(frameIndices);
+    QList<QImage> strokeFrames;
+    for (int frameIndex : model.getEditFrameIndices())
+        strokeFrames.append(*model.getFrame(frameIndex));
+    view.strokeRenderer->beginStroke(strokeFrames);
+    QBENCHMARK {
+        QPoint pixel(drawCount % canvasSize, (drawCount / canvasSize) % canvasSize);
+        view.strokeRenderer->addPixel(pixel, colors[(drawCount / (canvasSize * canvasSize)) % 2].rgba());
+        view.strokeRenderer->flush();
+        view.swapInStroke();
+        drawCount++;
+    }
+    view.strokeRenderer->endStroke();
+    model.endEdit();
+}
+
+
+// ===================================================
+// ===                PREVIEW FRAME                ===
+// ===================================================
+
+void SpriteEditorBenchmarks::previewFrame_data()
+{
+    QTest::addColumn<int>("canvasSize");
+
+    for (int canvasSize : {16, 32, 64, 128})
+        QTest::addRow("%dpx", canvasSize) << canvasSize;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::previewFrame
+ * Measures advancing the preview by one frame, including displaying it in the view.
+ */
+void SpriteEditorBenchmarks::previewFrame()
+{
+    QFETCH(int, canvasSize);
+
+    SpriteEditorModel model;
+    SpriteEditorView view(model);
+    fillWithNoise(model, canvasSize, 10);
+
+    QBENCHMARK {
+        model.animatePreviewFrame();
+    }
+}
+
+void SpriteEditorBenchmarks::previewHeldFrames_data()
+{
+    QTest::addColumn<int>("frameCount");
+
+    for (int frameCount : {10, 100, 1000})
+        QTest::addRow("%d frames", frameCount) << frameCount;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::previewHeldFrames
+ * Measures finding and showing the due frame when every frame is held for a different
+ * number of ticks, which searches the playback timeline.
+ */
+void SpriteEditorBenchmarks::previewHeldFrames()
+{
+    QFETCH(int, frameCount);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, 16, frameCount);
+    for (int i = 0; i < frameCount; i++)
+        model.setFrameDurations({i}, i % 8 + 1);
+
+    QBENCHMARK {
+        model.animatePreviewFrame();
+    }
+}
+
+
+// ===================================================
+// ===               FRAME TRANSFORMS              ===
+// ===================================================
+
+void SpriteEditorBenchmarks::replaceColors_data()
+{
+    QTest::addColumn<int>("canvasSize");
+    QTest::addColumn<int>("frameCount");
+
+    for (int frameCount : {100, 1000})
+        QTest::addRow("32px, %d frames", frameCount) << 32 << frameCount;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::replaceColors
+ * Measures replacing a color that covers every pixel of every frame, and changing it back.
+ */
+void SpriteEditorBenchmarks::replaceColors()
+{
+    QFETCH(int, canvasSize);
+    QFETCH(int, frameCount);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, canvasSize, frameCount);
+    for (int i = 0; i < frameCount; i++)
+        model.getFrame(i)->fill(Qt::black);
+    model.resetColorCounts();
+
+    QHash<QRgb, QRgb> toWhite{{qRgb(0, 0, 0), qRgb(255, 255, 255)}};
+    QHash<QRgb, QRgb> toBlack{{qRgb(255, 255, 255), qRgb(0, 0, 0)}};
+    QBENCHMARK {
+        model.replaceColors(toWhite);
+        model.replaceColors(toBlack);
+    }
+}
+
+void SpriteEditorBenchmarks::reduceColors_data()
+{
+    QTest::addColumn<bool>("dither");
+
+    QTest::addRow("32px, 100 frames, 16 colors") << false;
+    QTest::addRow("32px, 100 frames, 16 colors, dithered") << true;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::reduceColors
+ * Measures reducing frames of random pixels to 16 colors, and undoing the reduction.
+ */
+void SpriteEditorBenchmarks::reduceColors()
+{
+    QFETCH(bool, dither);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, 32, 100);
+
+    QBENCHMARK {
+        model.reduceColors(16, dither);
+        model.undo();
+    }
+}
+
+
+// ===================================================
+// ===                  SELECTION                  ===
+// ===================================================
+
+void SpriteEditorBenchmarks::moveSelection_data()
+{
+    QTest::addColumn<int>("canvasSize");
+
+    for (int canvasSize : {64, 256, 1024})
+        QTest::addRow("%dpx, half-size selection", canvasSize) << canvasSize;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::moveSelection
+ * Measures lifting a selection, moving it, committing it as one edit, and undoing the move.
+ */
+void SpriteEditorBenchmarks::moveSelection()
+{
+    QFETCH(int, canvasSize);
+
+    SpriteEditorModel model;
+    fillWithNoise(model, canvasSize, 1);
+    QRect selection(canvasSize / 4, canvasSize / 4, canvasSize / 2, canvasSize / 2);
+
+    QBENCHMARK {
+        model.selectRect(selection);
+        model.moveSelection(selection.topLeft() + QPoint(canvasSize / 8, canvasSize / 8));
+        model.commitSelection();
+        model.undo();
+    }
+}
+
+
+// ===================================================
+// ===                 INPUT REPLAY                ===
+// ===================================================
+
+void SpriteEditorBenchmarks::replayStroke_data()
+{
+    QTest::addColumn<int>("canvasSize");
+
+    for (int canvasSize : {16, 64, 256})
+        QTest::addRow("%dpx", canvasSize) << canvasSize;
+}
+
+/**
+ * @brief SpriteEditorBenchmarks::replayStroke
+ * Measures a looping pen stroke of 200 drags, replayed through the shown view's canvas,
+ * from each mouse event to the repaint it causes.
+ */
+void SpriteEditorBenchmarks::replayStroke()
+{
+    QFETCH(int, canvasSize);
+
+    SpriteEditorModel model;
+    SpriteEditorView view(model);
+    view.show();
+    model.newFile(canvasSize);
+
+    // The stroke is recorded on a 1x1 canvas, and scaled to the canvas size on replay.
+    QList<InputRecorder::RecordedInput> inputs;
+    const int dragCount = 200;
+    for (int i = 0; i <= dragCount + 1; i++)
+    {
+        double angle = 2 * M_PI * qMin(i, dragCount) / dragCount;
+        QPointF position(0.5 + 0.4 * qCos(angle), 0.5 + 0.4 * qSin(angle * 2));
+        QEvent::Type type = i == 0 ? QEvent::MouseButtonPress
+                          : i <= dragCount ? QEvent::MouseMove : QEvent::MouseButtonRelease;
+        Qt::MouseButtons buttons = type == QEvent::MouseButtonRelease ? Qt::NoButton : Qt::LeftButton;
+        Qt::MouseButton button = type == QEvent::MouseMove ? Qt::NoButton : Qt::LeftButton;
+        inputs.append(InputRecorder::RecordedInput{type, i * 8000000LL, position, button, buttons});
+    }
+
+    QBENCHMARK {
+        InputRecorder::replay(view.findChild<CanvasWidget*>(), &model, 1, inputs,
+                              [&view](){view.finishPendingStroke();});
+    }
+}
+
+
+/**
+ * @brief main
+ * Runs the benchmarks headlessly, logging to benchmark_results.xml unless an output is given.
+ *
+ * @param argc -- the number of command line arguments
+ * @param argv -- the QtTest command line arguments
+ * @return the number of failed benchmarks
+ */
+int main(int argc, char *argv[])
+{
+    // The benchmarks never need a window on screen.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    SpriteEditorBenchmarks benchmarks;
+
+    QStringList arguments = app.arguments();
+    if (!arguments.contains("-o"))
+        arguments << "-o" << "benchmark_results.xml,xml" << "-o" << "-,txt";
+
+    return QTest::qExec(&benchmarks, arguments);
+}
+
+#include "spriteeditorbenchmarks.moc"
@@ -0,0 +1,38 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the AnimationEncoder interface.
+ */
+
+
+#ifndef ANIMATIONENCODER_H
+#define ANIMATIONENCODER_H
+
+#include <QImage>
+#include <QList>
+#include <QString>
+
+
+/**
+ * @brief The AnimationEncoder class
+ * The interface shared by the animated image encoders. Frames are streamed through
+ * an encoder one at a time: begin() is given every frame up front so that the encoder
+ * can analyze them (e.g. to build a palette), after which addFrame() encodes and writes
+ * each frame in turn, and finish() completes the file.
+ */
+class AnimationEncoder
+{
+public:
+    virtual ~AnimationEncoder() = default;
+
+    virtual bool begin(QString, const QList<QImage>&) = 0;
+    virtual bool addFrame(const QImage&, int) = 0;
+    virtual bool finish() = 0;
+};
+
+#endif // ANIMATIONENCODER_H
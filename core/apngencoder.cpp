@@ -0,0 +1,351 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the implementation of the class definition located in apngencoder.h.
+ */
+
+
+#include "apngencoder.h"
+#include <QtEndian>
+
+
+/**
+ * @brief bigEndian32
+ * Packs a 32-bit value in the big-endian byte order used by PNG.
+ *
+ * @param value -- the value to pack
+ * @return the four packed bytes
+ */
+static QByteArray bigEndian32(quint32 value)
+{
+    QByteArray bytes(4, 0);
+    qToBigEndian(value, bytes.data());
+    return bytes;
+}
+
+/**
+ * @brief bigEndian16
+ * Packs a 16-bit value in the big-endian byte order used by PNG.
+ *
+ * @param value -- the value to pack
+ * @return the two packed bytes
+ */
+static QByteArray bigEndian16(quint16 value)
+{
+    QByteArray bytes(2, 0);
+    qToBigEndian(value, bytes.data());
+    return bytes;
+}
+
+/**
+ * @brief crc32
+ * Computes the CRC-32 checksum that closes every PNG chunk.
+ *
+ * @param data -- the chunk type and data
+ * @return the checksum
+ */
+static quint32 crc32(const QByteArray& data)
+{
+    static const QList<quint32> table = [](){
+        QList<quint32> entries(256);
+        for (quint32 n = 0; n < 256; n++)
+        {
+            quint32 c = n;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            entries[n] = c;
+        }
+        return entries;
+    }();
+
+    quint32 crc = 0xFFFFFFFFu;
+    for (char byte : data)
+        crc = table[(crc ^ uchar(byte)) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+
+/**
+ * @brief ApngEncoder::begin
+ * Decides between palette and RGBA storage, then writes the PNG signature, header,
+ * a placeholder animation control chunk, and the palette if one is used.
+ *
+ * @param fileDir -- the path of the APNG to write
+ * @param frames -- every frame that will be added, used to collect the colors
+ * @return true if the file could be opened, false otherwise
+ */
+bool ApngEncoder::begin(QString fileDir, const QList<QImage>& frames)
+{
+    if (frames.isEmpty())
+        return false;
+
+    canvasSize = frames[0].size();
+
+    // Collect the distinct colors, giving up on a palette once there are too many.
+    paletteIndices.clear();
+    isIndexed = true;
+    for (int i = 0; i < frames.count() && isIndexed; i++)
+    {
+        QImage argbFrame = frames[i].convertToFormat(QImage::Format_ARGB32);
+        for (int y = 0; y < argbFrame.height() && isIndexed; y++)
+        {
+            const QRgb* row = reinterpret_cast<const QRgb*>(argbFrame.constScanLine(y));
+            for (int x = 0; x < argbFrame.width(); x++)
+            {
+                if (!paletteIndices.contains(row[x]))
+                    paletteIndices.insert(row[x], paletteIndices.count());
+
+                if (paletteIndices.count() > 256)
+                {
+                    isIndexed = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    file.setFileName(fileDir);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    file.write("\x89PNG\r\n\x1A\n", 8);
+
+    QByteArray header = bigEndian32(canvasSize.width()) + bigEndian32(canvasSize.height());
+    header.append(char(8));
+    header.append(char(isIndexed ? 3 : 6));
+    header.append(3, char(0));
+    writeChunk("IHDR", header);
+
+    // The frame count is patched in by finish(), once hold frames have been merged.
+    animationControlOffset = file.pos();
+    writeChunk("acTL", bigEndian32(0) + bigEndian32(0));
+
+    if (isIndexed)
+    {
+        QByteArray palette(paletteIndices.count() * 3, 0);
+        QByteArray transparency(paletteIndices.count(), 0);
+        for (auto it = paletteIndices.constBegin(); it != paletteIndices.constEnd(); ++it)
+        {
+            palette[it.value() * 3] = char(qRed(it.key()));
+            palette[it.value() * 3 + 1] = char(qGreen(it.key()));
+            palette[it.value() * 3 + 2] = char(qBlue(it.key()));
+            transparency[it.value()] = char(qAlpha(it.key()));
+        }
+        writeChunk("PLTE", palette);
+        writeChunk("tRNS", transparency);
+    }
+
+    sequenceNumber = 0;
+    writtenFrames = 0;
+    hasPendingFrame = false;
+    return true;
+}
+
+/**
+ * @brief ApngEncoder::addFrame
+ * Adds a frame to the animation. The previous frame is written out once it is known
+ * whether this frame extends it.
+ *
+ * @param frame -- the frame to add
+ * @param delay -- how long the frame is shown, in milliseconds
+ * @return true if the frame was encoded, false otherwise
+ */
+bool ApngEncoder::addFrame(const QImage& frame, int delay)
+{
+    if (!file.isOpen() || frame.size() != canvasSize)
+        return false;
+
+    QImage argbFrame = frame.convertToFormat(QImage::Format_ARGB32);
+
+    if (!hasPendingFrame)
+    {
+        // The first frame doubles as the default image, so it always covers the whole canvas.
+        pendingFrame = argbFrame;
+        pendingRect = QRect(QPoint(0, 0), canvasSize);
+        pendingDelay = delay;
+        hasPendingFrame = true;
+        return true;
+    }
+
+    // Identical frames just extend how long the pending frame is shown.
+    if (argbFrame == pendingFrame)
+    {
+        pendingDelay += delay;
+        return true;
+    }
+
+    QRect changedRect = differenceBounds(pendingFrame, argbFrame);
+    writePendingFrame();
+
+    pendingFrame = argbFrame;
+    pendingRect = changedRect;
+    pendingDelay = delay;
+    return true;
+}
+
+/**
+ * @brief ApngEncoder::finish
+ * Writes the last frame and the closing chunk, then goes back and fills in the
+ * number of frames in the animation control chunk.
+ *
+ * @return true if the file was completed, false otherwise
+ */
+bool ApngEncoder::finish()
+{
+    if (!file.isOpen())
+        return false;
+
+    if (hasPendingFrame)
+        writePendingFrame();
+    hasPendingFrame = false;
+
+    writeChunk("IEND", QByteArray());
+
+    file.seek(animationControlOffset);
+    writeChunk("acTL", bigEndian32(writtenFrames) + bigEndian32(0));
+
+    file.close();
+    return file.error() == QFileDevice::NoError;
+}
+
+/**
+ * @brief ApngEncoder::writePendingFrame
+ * Writes the pending frame's control chunk followed by its compressed pixels. The
+ * changed rectangle replaces what was there (blend "source"), so pixels that turn
+ * transparent are handled without any disposal tricks.
+ */
+void ApngEncoder::writePendingFrame()
+{
+    QByteArray frameControl = bigEndian32(sequenceNumber++);
+    frameControl += bigEndian32(pendingRect.width());
+    frameControl += bigEndian32(pendingRect.height());
+    frameControl += bigEndian32(pendingRect.x());
+    frameControl += bigEndian32(pendingRect.y());
+    frameControl += bigEndian16(quint16(qMin(pendingDelay, 65535)));
+    frameControl += bigEndian16(1000);
+    frameControl.append(char(0));  // dispose_op: none
+    frameControl.append(char(0));  // blend_op: source
+    writeChunk("fcTL", frameControl);
+
+    QByteArray data = compressRegion(pendingFrame, pendingRect);
+    if (writtenFrames == 0)
+        writeChunk("IDAT", data);
+    else
+        writeChunk("fdAT", bigEndian32(sequenceNumber++) + data);
+
+    writtenFrames++;
+}
+
+/**
+ * @brief ApngEncoder::writeChunk
+ * Writes a PNG chunk: its length, type, data, and checksum.
+ *
+ * @param type -- the four-letter chunk type
+ * @param data -- the chunk data
+ */
+void ApngEncoder::writeChunk(const char* type, const QByteArray& data)
+{
+    QByteArray typeAndData = QByteArray(type, 4) + data;
+    file.write(bigEndian32(data.size()));
+    file.write(typeAndData);
+    file.write(bigEndian32(crc32(typeAndData)));
+}
+
+/**
+ * @brief ApngEncoder::compressRegion
+ * Filters and compresses the pixels of a region of a frame. Every scanline uses
+ * whichever of the None, Sub, and Up filters yields the smallest sum of absolute
+ * differences, which is the usual heuristic for picking PNG filters.
+ *
+ * @param frame -- the frame to read from
+ * @param region -- the region of the frame to compress
+ * @return the zlib stream of the filtered scanlines
+ */
+QByteArray ApngEncoder::compressRegion(const QImage& frame, QRect region)
+{
+    int bytesPerPixel = isIndexed ? 1 : 4;
+    int rowBytes = region.width() * bytesPerPixel;
+
+    QByteArray filtered;
+    filtered.reserve((rowBytes + 1) * region.height());
+    QByteArray previousRow(rowBytes, 0);
+    QByteArray row(rowBytes, 0);
+
+    for (int y = region.top(); y <= region.bottom(); y++)
+    {
+        const QRgb* pixels = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+        for (int x = 0; x < region.width(); x++)
+        {
+            QRgb pixel = pixels[region.x() + x];
+            if (isIndexed)
+            {
+                row[x] = char(paletteIndices.value(pixel));
+            }
+            else
+            {
+                row[x * 4] = char(qRed(pixel));
+                row[x * 4 + 1] = char(qGreen(pixel));
+                row[x * 4 + 2] = char(qBlue(pixel));
+                row[x * 4 + 3] = char(qAlpha(pixel));
+            }
+        }
+
+        QByteArray candidates[3] = {row, row, row};
+        for (int i = 0; i < rowBytes; i++)
+        {
+            uchar left = i >= bytesPerPixel ? uchar(row[i - bytesPerPixel]) : 0;
+            candidates[1][i] = char(uchar(row[i]) - left);
+            candidates[2][i] = char(uchar(row[i]) - uchar(previousRow[i]));
+        }
+
+        int bestFilter = 0;
+        qint64 bestScore = -1;
+        for (int filter = 0; filter < 3; filter++)
+        {
+            qint64 score = 0;
+            for (char byte : candidates[filter])
+                score += qAbs(int(qint8(byte)));
+            if (bestScore < 0 || score < bestScore)
+            {
+                bestFilter = filter;
+                bestScore = score;
+            }
+        }
+
+        filtered.append(char(bestFilter));
+        filtered.append(candidates[bestFilter]);
+        previousRow = row;
+    }
+
+    // qCompress() prefixes the zlib stream with its uncompressed length; PNG wants the bare stream.
+    return qCompress(filtered, 9).mid(4);
+}
+
+/**
+ * @brief ApngEncoder::differenceBounds
+ * Finds the bounds of the pixels that differ between two frames. Since APNG frames
+ * cannot be empty, identical frames produce a single-pixel rectangle.
+ *
+ * @param before -- the previous frame
+ * @param after -- the next frame
+ * @return the bounding rectangle of the changed pixels
+ */
+QRect ApngEncoder::differenceBounds(const QImage& before, const QImage& after)
+{
+    QRect bounds;
+    for (int y = 0; y < canvasSize.height(); y++)
+    {
+        const QRgb* beforeRow = reinterpret_cast<const QRgb*>(before.constScanLine(y));
+        const QRgb* afterRow = reinterpret_cast<const QRgb*>(after.constScanLine(y));
+        for (int x = 0; x < canvasSize.width(); x++)
+            if (beforeRow[x] != afterRow[x])
+                bounds = bounds.united(QRect(x, y, 1, 1));
+    }
+
+    return bounds.isEmpty() ? QRect(0, 0, 1, 1) : bounds;
+}
@@ -0,0 +1,57 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the ApngEncoder class.
+ */
+
+
+#ifndef APNGENCODER_H
+#define APNGENCODER_H
+
+#include "animationencoder.h"
+#include <QFile>
+#include <QHash>
+#include <QRect>
+
+
+/**
+ * @brief The ApngEncoder class
+ * Encodes frames into a looping animated PNG. Animations using 256 colors or fewer are
+ * stored with an exact palette; anything else is stored as full RGBA. Each frame only
+ * stores the rectangle that differs from the previous frame, and consecutive identical
+ * frames are merged into a single, longer frame.
+ */
+class ApngEncoder : public AnimationEncoder
+{
+public:
+    bool begin(QString, const QList<QImage>&) override;
+    bool addFrame(const QImage&, int) override;
+    bool finish() override;
+
+private:
+    QFile file;
+    QSize canvasSize;
+    bool isIndexed = false;
+    QHash<QRgb, int> paletteIndices;
+
+    qint64 animationControlOffset = 0;
+    quint32 sequenceNumber = 0;
+    int writtenFrames = 0;
+
+    bool hasPendingFrame = false;
+    QImage pendingFrame;
+    QRect pendingRect;
+    int pendingDelay = 0;
+
+    void writePendingFrame();
+    void writeChunk(const char*, const QByteArray&);
+    QByteArray compressRegion(const QImage&, QRect);
+    QRect differenceBounds(const QImage&, const QImage&);
+};
+
+#endif // APNGENCODER_H
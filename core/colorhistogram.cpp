@@ -0,0 +1,212 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the implementation of the class definition located in colorhistogram.h.
+ */
+
+
+#include "colorhistogram.h"
+#include <algorithm>
+
+
+/**
+ * @brief ColorHistogram::ColorHistogram
+ * Constructor. Creates an empty histogram.
+ */
+ColorHistogram::ColorHistogram()
+{
+
+}
+
+/**
+ * @brief ColorHistogram::ColorHistogram
+ * Constructor. Counts the colors of every pixel of a 32-bit ARGB image.
+ *
+ * @param image -- the image to count
+ */
+ColorHistogram::ColorHistogram(const QImage& image)
+    : ColorHistogram(image, image.rect())
+{
+
+}
+
+/**
+ * @brief ColorHistogram::ColorHistogram
+ * Constructor. Counts the colors of the pixels in a region of a 32-bit ARGB image.
+ * Sprites are mostly long runs of one color, so each run costs a single hash update.
+ *
+ * @param image -- the image to count
+ * @param rect -- the region to count, which must lie inside the image
+ */
+ColorHistogram::ColorHistogram(const QImage& image, QRect rect)
+{
+    if (rect.isEmpty())
+        return;
+
+    for (int y = rect.top(); y <= rect.bottom(); y++)
+    {
+        const QRgb* row = reinterpret_cast<const QRgb*>(image.constScanLine(y)) + rect.left();
+        QRgb runColor = row[0];
+        qint64 runLength = 0;
+        for (int x = 0; x < rect.width(); x++)
+        {
+            if (row[x] == runColor)
+            {
+                runLength++;
+                continue;
+            }
+            counts[runColor] += runLength;
+            runColor = row[x];
+            runLength = 1;
+        }
+        counts[runColor] += runLength;
+    }
+}
+
+/**
+ * @brief ColorHistogram::add
+ * Changes the count of one color.
+ *
+ * @param color -- the color to count
+ * @param count -- the number of pixels to add, or to take away if negative
+ */
+void ColorHistogram::add(QRgb color, qint64 count)
+{
+    if (count == 0)
+        return;
+
+    auto entry = counts.find(color);
+    if (entry == counts.end())
+        counts.insert(color, count);
+    else if ((*entry += count) == 0)
+        counts.erase(entry);
+}
+
+/**
+ * @brief ColorHistogram::add
+ * Adds the counts of another histogram to this one.
+ *
+ * @param other -- the histogram to add
+ */
+void ColorHistogram::add(const ColorHistogram& other)
+{
+    for (auto entry = other.counts.constBegin(); entry != other.counts.constEnd(); ++entry)
+        add(entry.key(), entry.value());
+}
+
+/**
+ * @brief ColorHistogram::subtract
+ * Takes the counts of another histogram away from this one.
+ *
+ * @param other -- the histogram to subtract
+ */
+void ColorHistogram::subtract(const ColorHistogram& other)
+{
+    for (auto entry = other.counts.constBegin(); entry != other.counts.constEnd(); ++entry)
+        add(entry.key(), -entry.value());
+}
+
+/**
+ * @brief ColorHistogram::remapped
+ * Works out the counts after every pixel of some colors is replaced with other colors,
+ * without needing the pixels themselves.
+ *
+ * @param colorMap -- maps each replaced color to its replacement
+ * @return the counts after the replacement
+ */
+ColorHistogram ColorHistogram::remapped(const QHash<QRgb, QRgb>& colorMap) const
+{
+    ColorHistogram result = *this;
+    for (auto entry = colorMap.constBegin(); entry != colorMap.constEnd(); ++entry)
+    {
+        // Move the original count, so that swapped pairs of colors don't move each other's pixels twice.
+        qint64 count = getCount(entry.key());
+        result.add(entry.key(), -count);
+        result.add(entry.value(), count);
+    }
+    return result;
+}
+
+/**
+ * @brief ColorHistogram::getCount
+ *
+ * @param color -- the color to look up
+ * @return the number of pixels with the color
+ */
+qint64 ColorHistogram::getCount(QRgb color) const
+{
+    return counts.value(color, 0);
+}
+
+/**
+ * @brief ColorHistogram::getColorCount
+ *
+ * @return the number of distinct colors counted
+ */
+int ColorHistogram::getColorCount() const
+{
+    return counts.size();
+}
+
+/**
+ * @brief ColorHistogram::isEmpty
+ *
+ * @return whether no colors are counted
+ */
+bool ColorHistogram::isEmpty() const
+{
+    return counts.isEmpty();
+}
+
+/**
+ * @brief ColorHistogram::getColors
+ *
+ * @return the counted colors, the most common first
+ */
+QList<QRgb> ColorHistogram::getColors() const
+{
+    QList<QRgb> colors = counts.keys();
+    std::sort(colors.begin(), colors.end(), [this](QRgb a, QRgb b)
+    {
+        qint64 countA = counts.value(a);
+        qint64 countB = counts.value(b);
+        return countA != countB ? countA > countB : a < b;
+    });
+    return colors;
+}
+
+/**
+ * @brief ColorHistogram::remapped
+ * Works out the counts after every pixel of some colors is replaced with other colors,
+ * without needing the pixels themselves.
+ *
+ * @param colorMap -- maps each replaced color to its replacement
+ * @return the counts after the replacement
+ */
+ColorHistogram ColorHistogram::remapped(const QHash<QRgb, QRgb>& colorMap) const
+{
+    ColorHistogram result = *this;
+    for (auto entry = colorMap.constBegin(); entry != colorMap.constEnd(); ++entry)
+    {
+        // Move the original count, so that swapped pairs of colors don't move each other's pixels twice.
+        qint64 count = getCount(entry.key());
+        result.add(entry.key(), -count);
+        result.add(entry.value(), count);
+    }
+    return result;
+}
+
+/**
+ * @brief ColorHistogram::getCounts
+ *
+ * @return the count of every color, keyed by color
+ */
+const QHash<QRgb, qint64>& ColorHistogram::getCounts() const
+{
+    return counts;
+}
@@ -0,0 +1,50 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the class definition for the ColorHistogram class.
+ */
+
+
+#ifndef COLORHISTOGRAM_H
+#define COLORHISTOGRAM_H
+
+#include <QHash>
+#include <QImage>
+#include <QList>
+
+
+/**
+ * @brief The ColorHistogram class
+ * Counts how many pixels have each color. Histograms can be added to and subtracted from
+ * each other, so a histogram can also hold the change in counts made by an edit, with
+ * negative counts for colors that lost pixels. Colors whose count reaches zero are dropped,
+ * so only colors that are actually present are ever listed.
+ */
+class ColorHistogram
+{
+public:
+    ColorHistogram();
+    explicit ColorHistogram(const QImage&);
+    ColorHistogram(const QImage&, QRect);
+
+    void add(QRgb, qint64);
+    void add(const ColorHistogram&);
+    void subtract(const ColorHistogram&);
+    ColorHistogram remapped(const QHash<QRgb, QRgb>&) const;
+
+    qint64 getCount(QRgb) const;
+    int getColorCount() const;
+    bool isEmpty() const;
+    QList<QRgb> getColors() const;
+    const QHash<QRgb, qint64>& getCounts() const;
+
+private:
+    QHash<QRgb, qint64> counts;
+};
+
+#endif // COLORHISTOGRAM_H
@@ -0,0 +1,249 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Braden Fiedel
+ *
+ * This file contains the implementation of the class definition located in colorquantizer.h.
+ */
+
+
+#include "colorquantizer.h"
+#include <algorithm>
+#include <climits>
+
+
+/**
+ * @brief channelValue
+ * Gets one of the RGB components of a color.
+ *
+ * @param color -- the color to read
+ * @param channel -- 0 for red, 1 for green, 2 for blue
+ * @return the value of the requested component
+ */
+static int channelValue(QRgb color, int channel)
+{
+    switch (channel)
+    {
+        case 0:
+            return qRed(color);
+        case 1:
+            return qGreen(color);
+        default:
+            return qBlue(color);
+    }
+}
+
+/**
+ * @brief ColorQuantizer::ColorQuantizer
+ * Constructor. Creates a quantizer that maps colors onto the given palette.
+ *
+ * @param palette -- the palette colors to map onto
+ */
+ColorQuantizer::ColorQuantizer(QList<QRgb> palette)
+    : palette{palette}
+{
+
+}
+
+/**
+ * @brief ColorQuantizer::getPalette
+ *
+ * @return the palette that colors are mapped onto
+ */
+QList<QRgb> ColorQuantizer::getPalette()
+{
+    return palette;
+}
+
+/**
+ * @brief ColorQuantizer::nearestIndex
+ * Finds the palette entry closest to the given color. Results are cached, since
+ * sprites reuse a handful of colors over and over.
+ *
+ * @param color -- the color to map
+ * @return the index of the nearest palette color
+ */
+int ColorQuantizer::nearestIndex(QRgb color)
+{
+    QRgb rgb = color & RGB_MASK;
+    auto cached = nearestCache.constFind(rgb);
+    if (cached != nearestCache.constEnd())
+        return cached.value();
+
+    int nearest = 0;
+    int nearestDistance = INT_MAX;
+    for (int i = 0; i < palette.count(); i++)
+    {
+        int redDiff = qRed(palette[i]) - qRed(rgb);
+        int greenDiff = qGreen(palette[i]) - qGreen(rgb);
+        int blueDiff = qBlue(palette[i]) - qBlue(rgb);
+        int distance = redDiff * redDiff + greenDiff * greenDiff + blueDiff * blueDiff;
+        if (distance < nearestDistance)
+        {
+            nearest = i;
+            nearestDistance = distance;
+        }
+    }
+
+    nearestCache.insert(rgb, nearest);
+    return nearest;
+}
+
+/**
+ * @brief ColorQuantizer::medianCut
+ * Reduces a color histogram to at most the given number of colors. The box of colors
+ * spanning the widest channel range is repeatedly split at its population-weighted median,
+ * and each final box contributes its weighted average color to the palette.
+ *
+ * @param histogram -- the number of pixels of each color
+ * @param maxColors -- the largest number of colors the palette may hold
+ * @return the reduced palette, as opaque colors
+ */
+QList<QRgb> ColorQuantizer::medianCut(const QHash<QRgb, qint64>& histogram, int maxColors)
+{
+    // Merge colors which only differ in alpha.
+    QHash<QRgb, qint64> rgbCounts;
+    for (auto it = histogram.constBegin(); it != histogram.constEnd(); ++it)
+        rgbCounts[it.key() & RGB_MASK] += it.value();
+
+    QList<QRgb> palette;
+    if (rgbCounts.count() <= maxColors)
+    {
+        for (auto it = rgbCounts.constBegin(); it != rgbCounts.constEnd(); ++it)
+            palette.append(it.key() | 0xff000000);
+        return palette;
+    }
+
+    QList<QList<QPair<QRgb, qint64>>> boxes(1);
+    for (auto it = rgbCounts.constBegin(); it != rgbCounts.constEnd(); ++it)
+        boxes[0].append(qMakePair(it.key(), it.value()));
+
+    while (boxes.count() < maxColors)
+    {
+        // Find the box with the widest range on any one channel.
+        int widestBox = -1;
+        int widestChannel = 0;
+        int widestRange = 0;
+        for (int i = 0; i < boxes.count(); i++)
+        {
+            if (boxes[i].count() < 2)
+                continue;
+
+            for (int channel = 0; channel < 3; channel++)
+            {
+                int low = 255;
+                int high = 0;
+                for (const auto& [color, count] : boxes[i])
+                {
+                    low = qMin(low, channelValue(color, channel));
+                    high = qMax(high, channelValue(color, channel));
+                }
+                if (high - low > widestRange)
+                {
+                    widestBox = i;
+                    widestChannel = channel;
+                    widestRange = high - low;
+                }
+            }
+        }
+
+        if (widestBox < 0)
+            break;
+
+        // Split the box at the weighted median of its widest channel.
+        QList<QPair<QRgb, qint64>> box = boxes.takeAt(widestBox);
+        std::sort(box.begin(), box.end(), [widestChannel](const auto& first, const auto& second) {
+            return channelValue(first.first, widestChannel) < channelValue(second.first, widestChannel);
+        });
+
+        qint64 population = 0;
+        for (const auto& [color, count] : box)
+            population += count;
+
+        qint64 runningCount = 0;
+        int split = 1;
+        for (; split < box.count() - 1; split++)
+        {
+            runningCount += box[split - 1].second;
+            if (runningCount * 2 >= population)
+                break;
+        }
+
+        boxes.append(box.mid(0, split));
+        boxes.append(box.mid(split));
+    }
+
+    for (const auto& box : boxes)
+    {
+        qint64 population = 0;
+        qint64 red = 0;
+        qint64 green = 0;
+        qint64 blue = 0;
+        for (const auto& [color, count] : box)
+        {
+            population += count;
+            red += qRed(color) * count;
+            green += qGreen(color) * count;
+            blue += qBlue(color) * count;
+        }
+        population = qMax<qint64>(population, 1);
+        palette.append(qRgb(red / population, green / population, blue / population));
+    }
+
+    return palette;
+}
+
+/**
+ * @brief ColorQuantizer::kMeans
+ * Improves a palette with k-means: every color of the histogram is assigned to its nearest
+ * palette color, and each palette color moves to the population-weighted average of the
+ * colors assigned to it, until no palette color moves or the iterations run out. Working
+ * on the histogram rather than on pixels keeps each iteration proportional to the number
+ * of distinct colors.
+ *
+ * @param histogram -- the number of pixels of each color
+ * @param palette -- the palette to start from, such as the result of a median cut
+ * @param iterations -- the largest number of iterations to run
+ * @return the improved palette, as opaque colors
+ */
+QList<QRgb> ColorQuantizer::kMeans(const QHash<QRgb, qint64>& histogram, QList<QRgb> palette, int iterations)
+{
+    for (int iteration = 0; iteration < iterations; iteration++)
+    {
+        ColorQuantizer quantizer(palette);
+        QList<qint64> population(palette.count());
+        QList<qint64> red(palette.count());
+        QList<qint64> green(palette.count());
+        QList<qint64> blue(palette.count());
+        for (auto it = histogram.constBegin(); it != histogram.constEnd(); ++it)
+        {
+            int nearest = quantizer.nearestIndex(it.key());
+            population[nearest] += it.value();
+            red[nearest] += qRed(it.key()) * it.value();
+            green[nearest] += qGreen(it.key()) * it.value();
+            blue[nearest] += qBlue(it.key()) * it.value();
+        }
+
+        bool moved = false;
+        for (int i = 0; i < palette.count(); i++)
+        {
+            if (population[i] == 0)
+                continue;
+
+            QRgb centroid = qRgb(red[i] / population[i], green[i] / population[i], blue[i] / population[i]);
+            if (centroid != palette[i])
+            {
+                palette[i] = centroid;
+                moved = true;
+            }
+        }
+
+        if (!moved)
+            break;
+    }
+
+    return palette;
+}
@@ -0,0 +1,43 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Braden Fiedel
+ *
+ * This file contains the class definition for the ColorQuantizer class.
+ */
+
+
+#ifndef COLORQUANTIZER_H
+#define COLORQUANTIZER_H
+
+#include <QColor>
+#include <QHash>
+#include <QList>
+
+
+/**
+ * @brief The ColorQuantizer class
+ * This class reduces a set of colors to a limited palette using median cut, and maps
+ * arbitrary colors to their nearest palette entry. Colors are compared by their RGB
+ * components only; alpha is left to the caller.
+ */
+class ColorQuantizer
+{
+public:
+    explicit ColorQuantizer(QList<QRgb> = QList<QRgb>());
+
+    static QList<QRgb> medianCut(const QHash<QRgb, qint64>&, int);
+    static QList<QRgb> kMeans(const QHash<QRgb, qint64>&, QList<QRgb>, int);
+
+    QList<QRgb> getPalette();
+    int nearestIndex(QRgb);
+
+private:
+    QList<QRgb> palette;
+    QHash<QRgb, int> nearestCache;
+};
+
+#endif // COLORQUANTIZER_H
@@ -0,0 +1,220 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the implementation of the class definition located in compressedspritefile.h.
+ */
+
+
+#include "compressedspritefile.h"
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <QThread>
+#include <QtConcurrent>
+#include <algorithm>
+
+
+/**
+ * @brief compressFrame
+ * Compresses the pixels of a frame as rows of RGBA bytes, which read the same on any machine.
+ *
+ * @param frame -- the frame to compress
+ * @return the compressed chunk
+ */
+static QByteArray compressFrame(const QImage& frame)
+{
+    QImage rgba = frame.convertToFormat(QImage::Format_RGBA8888);
+    return qCompress(rgba.constBits(), rgba.sizeInBytes());
+}
+
+/**
+ * @brief decompressFrame
+ * Decompresses a chunk written by compressFrame.
+ *
+ * @param chunk -- the compressed chunk
+ * @param canvasSize -- the side length of the frame, in pixels
+ * @return the frame, or a null image if the chunk is damaged or the wrong size
+ */
+static QImage decompressFrame(const QByteArray& chunk, int canvasSize)
+{
+    QByteArray pixels = qUncompress(chunk);
+    if (pixels.size() != qsizetype(canvasSize) * canvasSize * 4)
+        return QImage();
+
+    // Converting copies the pixels out of the buffer, which goes away on return.
+    QImage rgba(reinterpret_cast<const uchar*>(pixels.constData()), canvasSize, canvasSize,
+                canvasSize * 4, QImage::Format_RGBA8888);
+    return rgba.convertToFormat(QImage::Format_ARGB32);
+}
+
+/**
+ * @brief CompressedSpriteFile::write
+ * Writes frames to a file in the binary format. Every distinct frame is compressed
+ * concurrently before anything is written. The file is only replaced once it is written
+ * whole, so a failed or cancelled write leaves any existing file as it was.
+ *
+ * @param fileDir -- the file directory at which to write
+ * @param canvasSize -- the side length of the frames, in pixels
+ * @param frames -- the frames to write
+ * @param originalFrames -- for each frame, the index of the first frame with identical pixels (its own index if none)
+ * @param durations -- the number of animation ticks each frame is held for
+ * @param progress -- if set, called with the frames compressed so far and the total; returning false cancels
+ * @return true if the whole file was written, false otherwise
+ */
+bool CompressedSpriteFile::write(QString fileDir, int canvasSize, const QList<QImage>& frames,
+                                 const QList<int>& originalFrames, const QList<int>& durations,
+                                 std::function<bool(qint64, qint64)> progress)
+{
+    QList<QImage> distinctFrames;
+    for (int i = 0; i < frames.count(); i++)
+        if (originalFrames[i] == i)
+            distinctFrames.append(frames.at(i));
+
+    QList<QByteArray> chunks;
+    int batchSize = QThread::idealThreadCount() * FRAMES_PER_THREAD_BATCH;
+    for (int first = 0; first < distinctFrames.count(); first += batchSize)
+    {
+        chunks.append(QtConcurrent::blockingMapped<QList<QByteArray>>(distinctFrames.mid(first, batchSize),
+                                                                      compressFrame));
+        if (progress && !progress(chunks.count(), distinctFrames.count()))
+            return false;
+    }
+
+    QSaveFile file(fileDir);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_6_0);
+    out.writeRawData(MAGIC, MAGIC_LENGTH);
+    out << FORMAT_VERSION << quint32(canvasSize) << quint32(frames.count());
+
+    // A reference is the index of the earlier frame; a chunk is marked with -1 instead.
+    int chunkIndex = 0;
+    for (int i = 0; i < frames.count(); i++)
+    {
+        if (originalFrames[i] != i)
+            out << qint32(originalFrames[i]);
+        else
+            out << qint32(-1) << chunks[chunkIndex++];
+    }
+
+    // Durations are only written when some frame is held, so older readers still open the rest.
+    if (std::any_of(durations.begin(), durations.end(), [](int duration){return duration != 1;}))
+    {
+        QList<qint32> frameDurations(durations.begin(), durations.end());
+        out << frameDurations;
+    }
+
+    return out.status() == QDataStream::Ok && file.commit();
+}
+
+/**
+ * @brief CompressedSpriteFile::read
+ * Reads frames from a file in the binary format. Chunks are read a batch at a time, and each
+ * batch is decompressed concurrently before the next is read, so the first frames are ready
+ * long before a large file has been read whole. A referenced frame shares the pixels of the
+ * frame it refers to.
+ *
+ * @param fileDir -- the file directory to read from
+ * @param canvasSize -- set to the side length of the frames, in pixels
+ * @param frames -- set to the frames read
+ * @param durations -- set to the number of ticks each frame is held for, or emptied if the file has none
+ * @param progress -- if set, called with the frames decompressed so far and the total; returning false cancels
+ * @param framesReady -- if set, called after each batch with the canvas size, the number of frames
+ *                       in the file, and every frame ready so far, in order
+ * @return true if the file is in the binary format and was read whole, false otherwise
+ *         (in which case no output is changed)
+ */
+bool CompressedSpriteFile::read(QString fileDir, int& canvasSize, QList<QImage>& frames, QList<int>& durations,
+                                std::function<bool(qint64, qint64)> progress,
+                                std::function<void(int, int, const QList<QImage>&)> framesReady)
+{
+    QFile file(fileDir);
+    if (!file.open(QIODevice::ReadOnly) || file.read(MAGIC_LENGTH) != QByteArray(MAGIC, MAGIC_LENGTH))
+        return false;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_6_0);
+    quint32 version;
+    quint32 size;
+    quint32 frameCount;
+    in >> version >> size >> frameCount;
+    if (in.status() != QDataStream::Ok || version != FORMAT_VERSION
+        || size == 0 || size > MAX_CANVAS_SIZE || frameCount == 0)
+        return false;
+
+    // Every frame takes at least a reference's worth of bytes, which bounds a sensible frame count.
+    if (frameCount > file.size() / sizeof(qint32))
+        return false;
+
+    QList<QImage> readFrames;
+    QList<qint32> batchRefs;
+    QList<QByteArray> batchChunks;
+    int batchSize = QThread::idealThreadCount() * FRAMES_PER_THREAD_BATCH;
+    for (quint32 i = 0; i < frameCount; i++)
+    {
+        qint32 frameRef;
+        in >> frameRef;
+        if (frameRef < 0)
+        {
+            QByteArray chunk;
+            in >> chunk;
+            batchChunks.append(chunk);
+        }
+        else if (quint32(frameRef) >= i)
+        {
+            return false;
+        }
+        batchRefs.append(frameRef);
+
+        if (in.status() != QDataStream::Ok)
+            return false;
+
+        // The first frame is a batch of its own, so that it is ready as soon as it is read.
+        if (i > 0 && i + 1 < frameCount && batchChunks.count() < batchSize)
+            continue;
+
+        QList<QImage> distinctFrames = QtConcurrent::blockingMapped<QList<QImage>>(batchChunks, [size](const QByteArray& chunk)
+        {
+            return decompressFrame(chunk, size);
+        });
+
+        // A reference always points to an earlier frame, which is read by now.
+        int chunkIndex = 0;
+        for (qint32 batchRef : batchRefs)
+        {
+            if (batchRef >= 0)
+                readFrames.append(readFrames.at(batchRef));
+            else if (distinctFrames.at(chunkIndex).isNull())
+                return false;
+            else
+                readFrames.append(distinctFrames.at(chunkIndex++));
+        }
+        batchRefs.clear();
+        batchChunks.clear();
+
+        if (framesReady)
+            framesReady(size, frameCount, readFrames);
+        if (progress && !progress(readFrames.count(), frameCount))
+            return false;
+    }
+
+    QList<qint32> frameDurations;
+    if (!in.atEnd())
+    {
+        in >> frameDurations;
+        if (in.status() != QDataStream::Ok)
+            return false;
+    }
+
+    canvasSize = size;
+    frames = readFrames;
+    durations = QList<int>(frameDurations.begin(), frameDurations.end());
+    return true;
+}
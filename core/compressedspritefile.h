@@ -0,0 +1,51 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the CompressedSpriteFile class.
+ */
+
+
+#ifndef COMPRESSEDSPRITEFILE_H
+#define COMPRESSEDSPRITEFILE_H
+
+#include <QImage>
+#include <QList>
+#include <QString>
+#include <functional>
+
+
+/**
+ * @brief The CompressedSpriteFile class
+ * Reads and writes the binary sprite format. After a short header ("SSPZ", the format
+ * version, the canvas size, and the number of frames), each frame is either a reference to
+ * an earlier, identical frame, or a chunk of its RGBA pixels compressed with zlib on its
+ * own. Since no chunk depends on another, frames are compressed and decompressed concurrently.
+ * Files with any frame held for more than one tick end with the duration of every frame.
+ * Frames are compressed and decompressed in batches, between which progress is reported and
+ * the caller may cancel. When reading, the first frame is a batch of its own, and each batch
+ * is handed over as soon as it is decompressed.
+ */
+class CompressedSpriteFile
+{
+public:
+    static constexpr char FILE_SUFFIX[] = ".sspz";
+
+    static bool write(QString, int, const QList<QImage>&, const QList<int>&, const QList<int>&,
+                      std::function<bool(qint64, qint64)> = nullptr);
+    static bool read(QString, int&, QList<QImage>&, QList<int>&, std::function<bool(qint64, qint64)> = nullptr,
+                     std::function<void(int, int, const QList<QImage>&)> = nullptr);
+
+private:
+    static constexpr char MAGIC[] = "SSPZ";
+    static const quint32 FORMAT_VERSION = 1;
+    static const int MAGIC_LENGTH = 4;
+    static const quint32 MAX_CANVAS_SIZE = 4096;
+    static const int FRAMES_PER_THREAD_BATCH = 4;
+};
+
+#endif // COMPRESSEDSPRITEFILE_H
@@ -0,0 +1,14 @@
+# Links a project against the core static library.
+QT += core gui concurrent
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+win32:CONFIG(release, debug|release): CORE_LIB_DIR = $$OUT_PWD/../core/release
+else:win32:CONFIG(debug, debug|release): CORE_LIB_DIR = $$OUT_PWD/../core/debug
+else: CORE_LIB_DIR = $$OUT_PWD/../core
+
+LIBS += -L$$CORE_LIB_DIR -lcore
+
+win32-g++|!win32: PRE_TARGETDEPS += $$CORE_LIB_DIR/libcore.a
+else: PRE_TARGETDEPS += $$CORE_LIB_DIR/core.lib
@@ -0,0 +1,41 @@
+QT       += core gui concurrent
+QT       -= widgets
+
+TEMPLATE = lib
+CONFIG += staticlib c++17
+
+TARGET = core
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+SOURCES += \
+    apngencoder.cpp \
+    colorhistogram.cpp \
+    colorquantizer.cpp \
+    compressedspritefile.cpp \
+    frametransforms.cpp \
+    gifencoder.cpp \
+    jsonspritefile.cpp \
+    spriteedit.cpp \
+    spriteeditormodel.cpp \
+    spritesheetexporter.cpp \
+    strokerenderer.cpp \
+    tracer.cpp
+
+HEADERS += \
+    animationencoder.h \
+    apngencoder.h \
+    colorhistogram.h \
+    colorquantizer.h \
+    compressedspritefile.h \
+    frametransforms.h \
+    gifencoder.h \
+    jsonspritefile.h \
+    spriteedit.h \
+    spriteeditormodel.h \
+    spritesheetexporter.h \
+    spscqueue.h \
+    strokerenderer.h \
+    tracer.h
@@ -0,0 +1,351 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Braden Fiedel
+ *
+ * This file contains the implementation of the class definition located in frametransforms.h.
+ */
+
+
+#include "frametransforms.h"
+#include "colorquantizer.h"
+#include <QSet>
+#include <QtMath>
+#include <climits>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FRAMETRANSFORMS_SSE2
+#endif
+
+
+/**
+ * The 4x4 Bayer matrix, giving the order in which ordered dithering turns on each
+ * position of a 4x4 tile.
+ */
+static const int BAYER_MATRIX[4][4] = {{ 0,  8,  2, 10},
+                                       {12,  4, 14,  6},
+                                       { 3, 11,  1,  9},
+                                       {15,  7, 13,  5}};
+
+/**
+ * @brief ditherSpread
+ * Works out how far ordered dithering should push colors. A palette with colors far
+ * apart needs a wide spread for the dither pattern to blend them; a dense one needs little.
+ *
+ * @param palette -- the palette colors are being reduced to
+ * @return the average distance from each palette color to its nearest neighbor
+ */
+static int ditherSpread(const QList<QRgb>& palette)
+{
+    if (palette.count() < 2)
+        return 0;
+
+    double totalDistance = 0;
+    for (int i = 0; i < palette.count(); i++)
+    {
+        int nearestDistance = INT_MAX;
+        for (int j = 0; j < palette.count(); j++)
+        {
+            if (j == i)
+                continue;
+            int redDiff = qRed(palette[i]) - qRed(palette[j]);
+            int greenDiff = qGreen(palette[i]) - qGreen(palette[j]);
+            int blueDiff = qBlue(palette[i]) - qBlue(palette[j]);
+            nearestDistance = qMin(nearestDistance, redDiff * redDiff + greenDiff * greenDiff + blueDiff * blueDiff);
+        }
+        totalDistance += qSqrt(nearestDistance);
+    }
+    return qRound(totalDistance / palette.count());
+}
+
+
+/**
+ * @brief FrameTransforms::flipped
+ * Mirrors a frame across its vertical or horizontal center line.
+ *
+ * @param frame -- the frame to flip
+ * @param orientation -- Qt::Horizontal to flip left-to-right, Qt::Vertical to flip top-to-bottom
+ * @return the flipped frame
+ */
+QImage FrameTransforms::flipped(const QImage& frame, Qt::Orientation orientation)
+{
+    QImage result(frame.size(), QImage::Format_ARGB32);
+    int width = frame.width();
+    int height = frame.height();
+    size_t rowBytes = width * sizeof(QRgb);
+
+    for (int y = 0; y < height; y++)
+    {
+        const QRgb* source = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+        if (orientation == Qt::Vertical)
+        {
+            std::memcpy(result.scanLine(height - 1 - y), source, rowBytes);
+            continue;
+        }
+
+        QRgb* destination = reinterpret_cast<QRgb*>(result.scanLine(y));
+        for (int x = 0; x < width; x++)
+            destination[width - 1 - x] = source[x];
+    }
+    return result;
+}
+
+/**
+ * @brief FrameTransforms::rotated
+ * Rotates a square frame a quarter turn.
+ *
+ * @param frame -- the frame to rotate
+ * @param clockwise -- true to rotate clockwise, false to rotate counterclockwise
+ * @return the rotated frame
+ */
+QImage FrameTransforms::rotated(const QImage& frame, bool clockwise)
+{
+    QImage result(frame.height(), frame.width(), QImage::Format_ARGB32);
+    int width = frame.width();
+    int height = frame.height();
+
+    // Walk the destination row by row, so that writes stay sequential.
+    for (int y = 0; y < width; y++)
+    {
+        QRgb* destination = reinterpret_cast<QRgb*>(result.scanLine(y));
+        for (int x = 0; x < height; x++)
+        {
+            int sourceX = clockwise ? y : width - 1 - y;
+            int sourceY = clockwise ? height - 1 - x : x;
+            destination[x] = reinterpret_cast<const QRgb*>(frame.constScanLine(sourceY))[sourceX];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief FrameTransforms::shifted
+ * Moves the contents of a frame, wrapping what falls off one edge around to the opposite edge.
+ *
+ * @param frame -- the frame to shift
+ * @param dx -- the number of pixels to shift right (negative shifts left)
+ * @param dy -- the number of pixels to shift down (negative shifts up)
+ * @return the shifted frame
+ */
+QImage FrameTransforms::shifted(const QImage& frame, int dx, int dy)
+{
+    QImage result(frame.size(), QImage::Format_ARGB32);
+    int width = frame.width();
+    int height = frame.height();
+    if (width == 0 || height == 0)
+        return result;
+
+    // Bring the offsets into range, so that each row is at most two copies.
+    dx = ((dx % width) + width) % width;
+    dy = ((dy % height) + height) % height;
+
+    for (int y = 0; y < height; y++)
+    {
+        const QRgb* source = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+        QRgb* destination = reinterpret_cast<QRgb*>(result.scanLine((y + dy) % height));
+        std::memcpy(destination + dx, source, (width - dx) * sizeof(QRgb));
+        std::memcpy(destination, source + width - dx, dx * sizeof(QRgb));
+    }
+    return result;
+}
+
+/**
+ * @brief FrameTransforms::paletteSwapped
+ * Replaces colors of a frame according to a color map. Colors not in the map are kept.
+ * Small maps, which is nearly every map, are applied to four pixels at a time with SSE2
+ * where it is available. If no pixel changes, the frame itself is returned without copying.
+ *
+ * @param frame -- the frame to recolor
+ * @param colorMap -- maps each color to replace to its replacement
+ * @return the recolored frame
+ */
+QImage FrameTransforms::paletteSwapped(const QImage& frame, const QHash<QRgb, QRgb>& colorMap)
+{
+    // Shares the frame until the first pixel that changes.
+    QImage result = frame;
+    int width = frame.width();
+
+    if (colorMap.size() > MAX_LOOKUP_COLORS)
+    {
+        for (int y = 0; y < frame.height(); y++)
+        {
+            const QRgb* source = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+            QRgb* destination = nullptr;
+            for (int x = 0; x < width; x++)
+            {
+                auto replacement = colorMap.constFind(source[x]);
+                if (replacement == colorMap.constEnd())
+                    continue;
+                if (destination == nullptr)
+                    destination = reinterpret_cast<QRgb*>(result.scanLine(y));
+                destination[x] = *replacement;
+            }
+        }
+        return result;
+    }
+
+    // Lay the map out as a lookup table of parallel arrays.
+    QRgb fromColors[MAX_LOOKUP_COLORS];
+    QRgb toColors[MAX_LOOKUP_COLORS];
+    int colorCount = 0;
+    for (auto entry = colorMap.constBegin(); entry != colorMap.constEnd(); ++entry)
+    {
+        fromColors[colorCount] = entry.key();
+        toColors[colorCount] = entry.value();
+        colorCount++;
+    }
+
+#ifdef FRAMETRANSFORMS_SSE2
+    __m128i fromVectors[MAX_LOOKUP_COLORS];
+    __m128i toVectors[MAX_LOOKUP_COLORS];
+    for (int i = 0; i < colorCount; i++)
+    {
+        fromVectors[i] = _mm_set1_epi32(int(fromColors[i]));
+        toVectors[i] = _mm_set1_epi32(int(toColors[i]));
+    }
+#endif
+
+    for (int y = 0; y < frame.height(); y++)
+    {
+        const QRgb* source = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+        QRgb* destination = nullptr;
+        int x = 0;
+
+#ifdef FRAMETRANSFORMS_SSE2
+        for (; x + 4 <= width; x += 4)
+        {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + x));
+            __m128i recolored = pixels;
+            __m128i anyMatch = _mm_setzero_si128();
+            for (int i = 0; i < colorCount; i++)
+            {
+                // Keys are unique, so each pixel matches at most one entry.
+                __m128i match = _mm_cmpeq_epi32(pixels, fromVectors[i]);
+                recolored = _mm_or_si128(_mm_andnot_si128(match, recolored), _mm_and_si128(match, toVectors[i]));
+                anyMatch = _mm_or_si128(anyMatch, match);
+            }
+
+            if (_mm_movemask_epi8(anyMatch) == 0)
+                continue;
+            if (destination == nullptr)
+                destination = reinterpret_cast<QRgb*>(result.scanLine(y));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x), recolored);
+        }
+#endif
+
+        // Whatever is left of the row, or all of it without SSE2.
+        for (; x < width; x++)
+        {
+            for (int i = 0; i < colorCount; i++)
+            {
+                if (source[x] != fromColors[i])
+                    continue;
+                if (destination == nullptr)
+                    destination = reinterpret_cast<QRgb*>(result.scanLine(y));
+                destination[x] = toColors[i];
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief FrameTransforms::outlined
+ * Draws a one-pixel outline around the opaque shapes of a frame: every transparent pixel
+ * that touches an opaque pixel on a side is set to the outline color.
+ *
+ * @param frame -- the frame to outline
+ * @param outlineColor -- the color of the outline
+ * @return the outlined frame
+ */
+QImage FrameTransforms::outlined(const QImage& frame, QRgb outlineColor)
+{
+    QImage result = frame.copy();
+    int width = frame.width();
+    int height = frame.height();
+
+    for (int y = 0; y < height; y++)
+    {
+        const QRgb* above = y > 0 ? reinterpret_cast<const QRgb*>(frame.constScanLine(y - 1)) : nullptr;
+        const QRgb* row = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+        const QRgb* below = y < height - 1 ? reinterpret_cast<const QRgb*>(frame.constScanLine(y + 1)) : nullptr;
+        QRgb* destination = reinterpret_cast<QRgb*>(result.scanLine(y));
+
+        for (int x = 0; x < width; x++)
+        {
+            if (qAlpha(row[x]) != 0)
+                continue;
+
+            bool touchesShape = (x > 0 && qAlpha(row[x - 1]) != 0)
+                             || (x < width - 1 && qAlpha(row[x + 1]) != 0)
+                             || (above != nullptr && qAlpha(above[x]) != 0)
+                             || (below != nullptr && qAlpha(below[x]) != 0);
+            if (touchesShape)
+                destination[x] = outlineColor;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief FrameTransforms::quantized
+ * Maps every visible pixel of a frame to its nearest color in a palette, keeping its alpha.
+ * With dithering, each pixel is first nudged by its place in a 4x4 Bayer tile, so that
+ * gradients become patterns of the nearby palette colors instead of flat bands. Pixels
+ * already in the palette are kept as they are. If no pixel changes, the frame itself is
+ * returned without copying.
+ *
+ * @param frame -- the frame to reduce
+ * @param palette -- the opaque colors to reduce to
+ * @param dither -- whether to apply ordered dithering
+ * @return the reduced frame
+ */
+QImage FrameTransforms::quantized(const QImage& frame, const QList<QRgb>& palette, bool dither)
+{
+    QImage result = frame;
+    if (palette.isEmpty())
+        return result;
+
+    // Each call has its own quantizer, so frames can be reduced concurrently.
+    ColorQuantizer quantizer(palette);
+    QSet<QRgb> paletteColors;
+    for (QRgb color : palette)
+        paletteColors.insert(color & RGB_MASK);
+    int spread = dither ? ditherSpread(palette) : 0;
+
+    for (int y = 0; y < frame.height(); y++)
+    {
+        const QRgb* source = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+        QRgb* destination = nullptr;
+        for (int x = 0; x < frame.width(); x++)
+        {
+            QRgb pixel = source[x];
+            if (qAlpha(pixel) == 0 || paletteColors.contains(pixel & RGB_MASK))
+                continue;
+
+            QRgb target = pixel;
+            if (spread > 0)
+            {
+                // Offsets run from just under minus half the spread to just under plus half.
+                int offset = (BAYER_MATRIX[y % 4][x % 4] * 2 - 15) * spread / 32;
+                target = qRgb(qBound(0, qRed(pixel) + offset, 255),
+                              qBound(0, qGreen(pixel) + offset, 255),
+                              qBound(0, qBlue(pixel) + offset, 255));
+            }
+
+            QRgb replacement = (palette[quantizer.nearestIndex(target)] & RGB_MASK) | (pixel & ~RGB_MASK);
+            if (replacement == pixel)
+                continue;
+            if (destination == nullptr)
+                destination = reinterpret_cast<QRgb*>(result.scanLine(y));
+            destination[x] = replacement;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,41 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Braden Fiedel
+ *
+ * This file contains the class definition for the FrameTransforms class.
+ */
+
+
+#ifndef FRAMETRANSFORMS_H
+#define FRAMETRANSFORMS_H
+
+#include <QHash>
+#include <QImage>
+#include <QList>
+
+
+/**
+ * @brief The FrameTransforms class
+ * The whole-frame operations that can be applied to many frames at once. Each one reads
+ * a 32-bit ARGB frame and returns a new frame of the same size, leaving the original
+ * untouched, so that frames can be transformed concurrently and the originals kept for undo.
+ */
+class FrameTransforms
+{
+public:
+    static QImage flipped(const QImage&, Qt::Orientation);
+    static QImage rotated(const QImage&, bool);
+    static QImage shifted(const QImage&, int, int);
+    static QImage paletteSwapped(const QImage&, const QHash<QRgb, QRgb>&);
+    static QImage outlined(const QImage&, QRgb);
+    static QImage quantized(const QImage&, const QList<QRgb>&, bool);
+
+private:
+    static const int MAX_LOOKUP_COLORS = 16;
+};
+
+#endif // FRAMETRANSFORMS_H
@@ -0,0 +1,342 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the implementation of the class definition located in gifencoder.h.
+ */
+
+
+#include "gifencoder.h"
+
+
+/**
+ * @brief GifEncoder::begin
+ * Builds the global palette from every frame and writes the GIF header, the palette,
+ * and the extension that makes the animation loop forever.
+ *
+ * @param fileDir -- the path of the GIF to write
+ * @param frames -- every frame that will be added, used to build the palette
+ * @return true if the file could be opened, false otherwise
+ */
+bool GifEncoder::begin(QString fileDir, const QList<QImage>& frames)
+{
+    if (frames.isEmpty())
+        return false;
+
+    canvasSize = frames[0].size();
+
+    // GIF transparency is all-or-nothing, so only the mostly-opaque pixels take up palette entries.
+    QHash<QRgb, qint64> histogram;
+    for (const QImage& frame : frames)
+    {
+        QImage argbFrame = frame.convertToFormat(QImage::Format_ARGB32);
+        for (int y = 0; y < argbFrame.height(); y++)
+        {
+            const QRgb* row = reinterpret_cast<const QRgb*>(argbFrame.constScanLine(y));
+            for (int x = 0; x < argbFrame.width(); x++)
+                if (qAlpha(row[x]) >= 128)
+                    histogram[row[x]]++;
+        }
+    }
+    quantizer = ColorQuantizer(ColorQuantizer::medianCut(histogram, 255));
+
+    file.setFileName(fileDir);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    // Header and logical screen descriptor, flagging a 256-entry global color table.
+    file.write("GIF89a");
+    writeLittleEndian16(canvasSize.width());
+    writeLittleEndian16(canvasSize.height());
+    file.putChar(char(0xF7));
+    file.putChar(TRANSPARENT_INDEX);
+    file.putChar(0);
+
+    // Global color table, with the transparent entry first.
+    QByteArray colorTable(256 * 3, 0);
+    QList<QRgb> palette = quantizer.getPalette();
+    for (int i = 0; i < palette.count(); i++)
+    {
+        colorTable[(i + 1) * 3] = char(qRed(palette[i]));
+        colorTable[(i + 1) * 3 + 1] = char(qGreen(palette[i]));
+        colorTable[(i + 1) * 3 + 2] = char(qBlue(palette[i]));
+    }
+    file.write(colorTable);
+
+    // NETSCAPE2.0 application extension: loop forever.
+    file.write("\x21\xFF\x0B" "NETSCAPE2.0" "\x03\x01", 16);
+    writeLittleEndian16(0);
+    file.putChar(0);
+
+    hasPendingFrame = false;
+    return true;
+}
+
+/**
+ * @brief GifEncoder::addFrame
+ * Adds a frame to the animation. The previous frame is written out once it is known
+ * how this frame differs from it.
+ *
+ * @param frame -- the frame to add
+ * @param delay -- how long the frame is shown, in milliseconds
+ * @return true if the frame was encoded, false otherwise
+ */
+bool GifEncoder::addFrame(const QImage& frame, int delay)
+{
+    if (!file.isOpen() || frame.size() != canvasSize)
+        return false;
+
+    QByteArray indices = quantizeFrame(frame);
+
+    if (!hasPendingFrame)
+    {
+        pending.base = QByteArray(indices.size(), TRANSPARENT_INDEX);
+        pending.indices = indices;
+        pending.rect = differenceBounds(pending.base, indices);
+        pending.delay = delay;
+        pending.restoreBackground = false;
+        hasPendingFrame = true;
+        return true;
+    }
+
+    // Identical frames just extend how long the pending frame is shown.
+    if (indices == pending.indices)
+    {
+        pending.delay += delay;
+        return true;
+    }
+
+    // A drawn pixel can only be turned transparent again by restoring the previous frame's
+    // area to the background, so grow that area to cover every pixel this frame clears.
+    QRect clearedRect = clearedBounds(pending.indices, indices);
+    if (!clearedRect.isEmpty())
+    {
+        pending.rect = pending.rect.united(clearedRect);
+        pending.restoreBackground = true;
+    }
+    writePendingFrame();
+
+    // Work out what the screen shows once the previous frame has been disposed of.
+    QByteArray base = pending.indices;
+    if (pending.restoreBackground)
+        for (int y = pending.rect.top(); y <= pending.rect.bottom(); y++)
+            memset(base.data() + y * canvasSize.width() + pending.rect.x(), TRANSPARENT_INDEX, pending.rect.width());
+
+    pending.base = base;
+    pending.indices = indices;
+    pending.rect = differenceBounds(base, indices);
+    pending.delay = delay;
+    pending.restoreBackground = false;
+    return true;
+}
+
+/**
+ * @brief GifEncoder::finish
+ * Writes the last frame and the GIF trailer, and closes the file.
+ *
+ * @return true if the file was completed, false otherwise
+ */
+bool GifEncoder::finish()
+{
+    if (!file.isOpen())
+        return false;
+
+    if (hasPendingFrame)
+        writePendingFrame();
+    hasPendingFrame = false;
+
+    file.putChar(0x3B);
+    file.close();
+    return file.error() == QFileDevice::NoError;
+}
+
+/**
+ * @brief GifEncoder::quantizeFrame
+ * Maps every pixel of a frame to its global palette index. Pixels that are less than
+ * half opaque become transparent.
+ *
+ * @param frame -- the frame to quantize
+ * @return one palette index per pixel, row by row
+ */
+QByteArray GifEncoder::quantizeFrame(const QImage& frame)
+{
+    QImage argbFrame = frame.convertToFormat(QImage::Format_ARGB32);
+    QByteArray indices(canvasSize.width() * canvasSize.height(), TRANSPARENT_INDEX);
+
+    for (int y = 0; y < canvasSize.height(); y++)
+    {
+        const QRgb* row = reinterpret_cast<const QRgb*>(argbFrame.constScanLine(y));
+        char* indexRow = indices.data() + y * canvasSize.width();
+        for (int x = 0; x < canvasSize.width(); x++)
+            if (qAlpha(row[x]) >= 128)
+                indexRow[x] = char(quantizer.nearestIndex(row[x]) + 1);
+    }
+
+    return indices;
+}
+
+/**
+ * @brief GifEncoder::differenceBounds
+ * Finds the bounds of the pixels that differ between two indexed frames. Since GIF
+ * frames cannot be empty, identical frames produce a single-pixel rectangle.
+ *
+ * @param before -- the indexed pixels currently on screen
+ * @param after -- the indexed pixels of the next frame
+ * @return the bounding rectangle of the changed pixels
+ */
+QRect GifEncoder::differenceBounds(const QByteArray& before, const QByteArray& after)
+{
+    QRect bounds;
+    for (int y = 0; y < canvasSize.height(); y++)
+        for (int x = 0; x < canvasSize.width(); x++)
+            if (before[y * canvasSize.width() + x] != after[y * canvasSize.width() + x])
+                bounds = bounds.united(QRect(x, y, 1, 1));
+
+    return bounds.isEmpty() ? QRect(0, 0, 1, 1) : bounds;
+}
+
+/**
+ * @brief GifEncoder::clearedBounds
+ * Finds the bounds of the pixels that are drawn in one indexed frame and transparent
+ * in the next.
+ *
+ * @param before -- the indexed pixels currently on screen
+ * @param after -- the indexed pixels of the next frame
+ * @return the bounding rectangle of the cleared pixels, or an empty rectangle if there are none
+ */
+QRect GifEncoder::clearedBounds(const QByteArray& before, const QByteArray& after)
+{
+    QRect bounds;
+    for (int y = 0; y < canvasSize.height(); y++)
+        for (int x = 0; x < canvasSize.width(); x++)
+            if (before[y * canvasSize.width() + x] != TRANSPARENT_INDEX
+                    && after[y * canvasSize.width() + x] == TRANSPARENT_INDEX)
+                bounds = bounds.united(QRect(x, y, 1, 1));
+
+    return bounds;
+}
+
+/**
+ * @brief GifEncoder::writePendingFrame
+ * Writes the pending frame's graphic control extension, image descriptor, and pixels.
+ * Pixels that already match the screen are written as transparent, which leaves them
+ * showing through and compresses far better.
+ */
+void GifEncoder::writePendingFrame()
+{
+    // Graphic control extension: disposal method, transparency, and delay (in centiseconds).
+    int disposal = pending.restoreBackground ? 2 : 1;
+    file.write("\x21\xF9\x04", 3);
+    file.putChar(char((disposal << 2) | 1));
+    writeLittleEndian16(qMax(2, qRound(pending.delay / 10.0)));
+    file.putChar(TRANSPARENT_INDEX);
+    file.putChar(0);
+
+    // Image descriptor, using the global color table.
+    file.putChar(0x2C);
+    writeLittleEndian16(pending.rect.x());
+    writeLittleEndian16(pending.rect.y());
+    writeLittleEndian16(pending.rect.width());
+    writeLittleEndian16(pending.rect.height());
+    file.putChar(0);
+
+    QByteArray rectIndices;
+    rectIndices.reserve(pending.rect.width() * pending.rect.height());
+    for (int y = pending.rect.top(); y <= pending.rect.bottom(); y++)
+    {
+        for (int x = pending.rect.left(); x <= pending.rect.right(); x++)
+        {
+            int i = y * canvasSize.width() + x;
+            rectIndices.append(pending.indices[i] == pending.base[i] ? char(TRANSPARENT_INDEX) : pending.indices[i]);
+        }
+    }
+    writeLzw(rectIndices);
+}
+
+/**
+ * @brief GifEncoder::writeLzw
+ * LZW-compresses palette indices and writes them as GIF data sub-blocks.
+ *
+ * @param indices -- the palette indices to compress
+ */
+void GifEncoder::writeLzw(const QByteArray& indices)
+{
+    const int clearCode = 1 << MIN_CODE_SIZE;
+    const int endCode = clearCode + 1;
+    int codeSize = MIN_CODE_SIZE + 1;
+    int maxCode = endCode;
+    QHash<int, int> dictionary;
+
+    QByteArray output;
+    quint32 bitBuffer = 0;
+    int bitCount = 0;
+    auto writeCode = [&](int code) {
+        bitBuffer |= quint32(code) << bitCount;
+        bitCount += codeSize;
+        while (bitCount >= 8)
+        {
+            output.append(char(bitBuffer & 0xFF));
+            bitBuffer >>= 8;
+            bitCount -= 8;
+        }
+    };
+
+    writeCode(clearCode);
+    int current = uchar(indices[0]);
+    for (int i = 1; i < indices.size(); i++)
+    {
+        int next = uchar(indices[i]);
+        int key = (current << 8) | next;
+
+        auto existing = dictionary.constFind(key);
+        if (existing != dictionary.constEnd())
+        {
+            current = existing.value();
+            continue;
+        }
+
+        writeCode(current);
+        dictionary.insert(key, ++maxCode);
+        if (maxCode >= (1 << codeSize))
+            codeSize++;
+
+        // The code table is full: start over with a fresh dictionary.
+        if (maxCode == 4095)
+        {
+            writeCode(clearCode);
+            dictionary.clear();
+            codeSize = MIN_CODE_SIZE + 1;
+            maxCode = endCode;
+        }
+        current = next;
+    }
+    writeCode(current);
+    writeCode(endCode);
+    if (bitCount > 0)
+        output.append(char(bitBuffer & 0xFF));
+
+    file.putChar(MIN_CODE_SIZE);
+    for (int offset = 0; offset < output.size(); offset += 255)
+    {
+        int blockSize = qMin(255, int(output.size()) - offset);
+        file.putChar(char(blockSize));
+        file.write(output.constData() + offset, blockSize);
+    }
+    file.putChar(0);
+}
+
+/**
+ * @brief GifEncoder::writeLittleEndian16
+ * Writes a 16-bit value in the little-endian byte order used by GIF.
+ *
+ * @param value -- the value to write
+ */
+void GifEncoder::writeLittleEndian16(int value)
+{
+    file.putChar(char(value & 0xFF));
+    file.putChar(char((value >> 8) & 0xFF));
+}
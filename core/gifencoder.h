@@ -0,0 +1,68 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the GifEncoder class.
+ */
+
+
+#ifndef GIFENCODER_H
+#define GIFENCODER_H
+
+#include "animationencoder.h"
+#include "colorquantizer.h"
+#include <QFile>
+#include <QRect>
+
+
+/**
+ * @brief The GifEncoder class
+ * Encodes frames into a looping animated GIF. All frames share one global palette of
+ * up to 255 colors (index 0 is reserved for transparency), quantized with median cut.
+ * Each frame only stores the rectangle that differs from what is already on screen,
+ * and consecutive identical frames are merged into a single, longer frame.
+ */
+class GifEncoder : public AnimationEncoder
+{
+public:
+    bool begin(QString, const QList<QImage>&) override;
+    bool addFrame(const QImage&, int) override;
+    bool finish() override;
+
+private:
+    /**
+     * @brief The PendingFrame struct
+     * A frame waiting to be written. Frames are held back by one, since whether a frame
+     * must be cleared after display depends on the frame that follows it.
+     */
+    struct PendingFrame
+    {
+        QByteArray indices;
+        QByteArray base;
+        QRect rect;
+        int delay = 0;
+        bool restoreBackground = false;
+    };
+
+    static const int TRANSPARENT_INDEX = 0;
+    static const int MIN_CODE_SIZE = 8;
+
+    QFile file;
+    QSize canvasSize;
+    ColorQuantizer quantizer;
+    bool hasPendingFrame = false;
+    PendingFrame pending;
+
+    QByteArray quantizeFrame(const QImage&);
+    QRect differenceBounds(const QByteArray&, const QByteArray&);
+    QRect clearedBounds(const QByteArray&, const QByteArray&);
+    void writePendingFrame();
+    void writeLzw(const QByteArray&);
+    void writeLittleEndian16(int);
+};
+
+#endif // GIFENCODER_H
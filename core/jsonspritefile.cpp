@@ -0,0 +1,604 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the implementation of the class definition located in jsonspritefile.h.
+ */
+
+
+#include "jsonspritefile.h"
+#include <QFile>
+#include <QHash>
+#include <QSaveFile>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+
+/**
+ * @brief The JsonTokenizer class
+ * Pulls JSON from a device a block at a time. The caller walks the structure it expects,
+ * and skips any value it has no use for, so no more than a block of text is held at once.
+ */
+class JsonTokenizer
+{
+public:
+    explicit JsonTokenizer(QIODevice* device)
+        : device{device}
+    {
+
+    }
+
+    int peek();
+    bool consume(char);
+    bool readString(QByteArray&);
+    bool readInt(int&);
+    bool skipValue();
+
+private:
+    static const int READ_SIZE = 1 << 16;
+
+    QIODevice* device;
+    QByteArray buffer;
+    qsizetype position = 0;
+
+    bool refill();
+};
+
+/**
+ * @brief JsonTokenizer::refill
+ * Reads the next block of text once the current one has been used up.
+ *
+ * @return false if there is no text left
+ */
+bool JsonTokenizer::refill()
+{
+    if (position < buffer.size())
+        return true;
+
+    buffer = device->read(READ_SIZE);
+    position = 0;
+    return !buffer.isEmpty();
+}
+
+/**
+ * @brief JsonTokenizer::peek
+ * Skips whitespace, then looks at the next character without consuming it.
+ *
+ * @return the next character, or -1 at the end of the text
+ */
+int JsonTokenizer::peek()
+{
+    while (refill())
+    {
+        char c = buffer.at(position);
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t')
+            return uchar(c);
+        position++;
+    }
+    return -1;
+}
+
+/**
+ * @brief JsonTokenizer::consume
+ * Consumes the next character if it is the one expected.
+ *
+ * @param expected -- the character expected next, after any whitespace
+ * @return whether the character was there
+ */
+bool JsonTokenizer::consume(char expected)
+{
+    if (peek() != uchar(expected))
+        return false;
+
+    position++;
+    return true;
+}
+
+/**
+ * @brief JsonTokenizer::readString
+ * Reads a string. Escaped characters are kept as the character after the backslash,
+ * which is all the sprite format's keys need.
+ *
+ * @param string -- set to the contents of the string
+ * @return false if the next value isn't a whole string
+ */
+bool JsonTokenizer::readString(QByteArray& string)
+{
+    if (!consume('"'))
+        return false;
+
+    string.clear();
+    while (refill())
+    {
+        char c = buffer.at(position++);
+        if (c == '"')
+            return true;
+        if (c == '\\')
+        {
+            if (!refill())
+                return false;
+            c = buffer.at(position++);
+        }
+        string += c;
+    }
+    return false;
+}
+
+/**
+ * @brief JsonTokenizer::readInt
+ * Reads a value as QJsonValue::toInt() would: a number that is a whole int is read as
+ * that int, and anything else (another number, or a value that isn't a number) as 0.
+ *
+ * @param value -- set to the value read
+ * @return false if the text isn't valid where the value should be
+ */
+bool JsonTokenizer::readInt(int& value)
+{
+    value = 0;
+    int c = peek();
+    if (c != '-' && (c < '0' || c > '9'))
+        return skipValue();
+
+    char token[32];
+    int length = 0;
+    bool integral = true;
+    while (refill())
+    {
+        c = buffer.at(position);
+        if (c == '.' || c == 'e' || c == 'E' || c == '+')
+            integral = false;
+        else if (c != '-' && (c < '0' || c > '9'))
+            break;
+        if (length == int(sizeof(token)) - 1)
+            return false;
+        token[length++] = c;
+        position++;
+    }
+    token[length] = '\0';
+
+    // Pixel values are short whole numbers, so they skip the conversion through double.
+    if (integral && length <= 10)
+    {
+        qint64 number = std::strtoll(token, nullptr, 10);
+        if (number >= INT_MIN && number <= INT_MAX)
+            value = int(number);
+        return true;
+    }
+
+    double number = std::strtod(token, nullptr);
+    if (number >= INT_MIN && number <= INT_MAX && number == std::floor(number))
+        value = int(number);
+    return true;
+}
+
+/**
+ * @brief JsonTokenizer::skipValue
+ * Consumes the next value, whatever it is, without keeping any of it.
+ *
+ * @return false if the text isn't a valid value
+ */
+bool JsonTokenizer::skipValue()
+{
+    QByteArray ignored;
+    int c = peek();
+    if (c == '"')
+        return readString(ignored);
+
+    if (c == '{' || c == '[')
+    {
+        char close = c == '{' ? '}' : ']';
+        position++;
+        if (consume(close))
+            return true;
+        do
+        {
+            if (close == '}' && (!readString(ignored) || !consume(':')))
+                return false;
+            if (!skipValue())
+                return false;
+        } while (consume(','));
+        return consume(close);
+    }
+
+    // Numbers, true, false, and null run until the next delimiter.
+    int length = 0;
+    while (refill())
+    {
+        c = buffer.at(position);
+        if (c == ',' || c == ']' || c == '}' || c == ' ' || c == '\n' || c == '\r' || c == '\t')
+            break;
+        position++;
+        length++;
+    }
+    return length > 0;
+}
+
+
+/**
+ * @brief frameKey
+ *
+ * @param frameIndex -- the index of a frame
+ * @return the key the frame is stored under
+ */
+static QByteArray frameKey(int frameIndex)
+{
+    return "frame" + QByteArray::number(frameIndex);
+}
+
+/**
+ * @brief frameIndexFromKey
+ *
+ * @param key -- a key of the "frames" or "frameRefs" object
+ * @return the index of the frame stored under the key, or -1 if it isn't a frame key
+ */
+static int frameIndexFromKey(const QByteArray& key)
+{
+    bool ok;
+    int frameIndex = key.mid(5).toInt(&ok);
+    if (!ok || frameIndex < 0 || frameKey(frameIndex) != key)
+        return -1;
+    return frameIndex;
+}
+
+/**
+ * @brief readPixel
+ * Reads a pixel's array of red, green, blue, and alpha values. Missing values are 0,
+ * and a pixel that isn't an array is transparent.
+ *
+ * @param json -- the text being read
+ * @param pixel -- set to the pixel read
+ * @return false if the text isn't valid
+ */
+static bool readPixel(JsonTokenizer& json, QRgb& pixel)
+{
+    pixel = 0;
+    if (!json.consume('['))
+        return json.skipValue();
+    if (json.consume(']'))
+        return true;
+
+    int channels[4] = {0, 0, 0, 0};
+    int channel = 0;
+    do
+    {
+        int ignored;
+        if (!json.readInt(channel < 4 ? channels[channel] : ignored))
+            return false;
+        channel++;
+    } while (json.consume(','));
+
+    pixel = qRgba(channels[0], channels[1], channels[2], channels[3]);
+    return json.consume(']');
+}
+
+/**
+ * @brief readRow
+ * Reads a row of pixels. A row that isn't an array has no pixels.
+ *
+ * @param json -- the text being read
+ * @param row -- set to the pixels of the row
+ * @return false if the text isn't valid
+ */
+static bool readRow(JsonTokenizer& json, QList<QRgb>& row)
+{
+    row.clear();
+    if (!json.consume('['))
+        return json.skipValue();
+    if (json.consume(']'))
+        return true;
+
+    do
+    {
+        QRgb pixel;
+        if (!readPixel(json, pixel))
+            return false;
+        row.append(pixel);
+    } while (json.consume(','));
+    return json.consume(']');
+}
+
+/**
+ * @brief readFramePixels
+ * Reads a frame's rows of pixels into a frame. The canvas size is stored after the frames,
+ * so the frame is made square, as wide as its first row; the caller crops or pads it once
+ * the size is known. Pixels past the frame's edges are dropped.
+ *
+ * @param json -- the text being read
+ * @param frame -- set to the frame read, or a null image if it has no pixels
+ * @param row -- a buffer for one row of pixels
+ * @return false if the text isn't valid
+ */
+static bool readFramePixels(JsonTokenizer& json, QImage& frame, QList<QRgb>& row)
+{
+    frame = QImage();
+    if (!json.consume('['))
+        return json.skipValue();
+    if (json.consume(']'))
+        return true;
+
+    int y = 0;
+    do
+    {
+        if (!readRow(json, row))
+            return false;
+
+        if (frame.isNull() && !row.isEmpty())
+        {
+            frame = QImage(row.count(), row.count(), QImage::Format_ARGB32);
+            frame.fill(Qt::transparent);
+        }
+        if (!frame.isNull() && y < frame.height())
+            std::memcpy(frame.scanLine(y), row.constData(), qMin(row.count(), frame.width()) * sizeof(QRgb));
+        y++;
+    } while (json.consume(','));
+    return json.consume(']');
+}
+
+/**
+ * @brief readDurations
+ * Reads the array of frame durations. Durations that aren't arrays are empty.
+ *
+ * @param json -- the text being read
+ * @param durations -- set to the number of ticks each frame is held for
+ * @return false if the text isn't valid
+ */
+static bool readDurations(JsonTokenizer& json, QList<int>& durations)
+{
+    durations.clear();
+    if (!json.consume('['))
+        return json.skipValue();
+    if (json.consume(']'))
+        return true;
+
+    do
+    {
+        int duration;
+        if (!json.readInt(duration))
+            return false;
+        durations.append(duration);
+    } while (json.consume(','));
+    return json.consume(']');
+}
+
+/**
+ * @brief JsonSpriteFile::write
+ * Writes frames to a file in the JSON format. The text is exactly what serializing the
+ * format with QJsonDocument::toJson() gives, including its sorted keys, but is written a
+ * block at a time, so memory use doesn't grow with the size of the sprite. The file is only
+ * replaced once it is written whole, so a failed or cancelled write leaves any existing file
+ * as it was. Every frame is written pixel by pixel, even one identical to an earlier frame,
+ * so that any reader of the format gets every frame back.
+ *
+ * @param fileDir -- the file directory at which to write
+ * @param canvasSize -- the side length of the frames, in pixels
+ * @param frames -- the frames to write
+ * @param durations -- the number of animation ticks each frame is held for
+ * @param progress -- if set, called with the frames written so far and the total; returning false cancels
+ * @return true if the whole file was written, false otherwise
+ */
+bool JsonSpriteFile::write(QString fileDir, int canvasSize, const QList<QImage>& frames,
+                           const QList<int>& durations, std::function<bool(qint64, qint64)> progress)
+{
+    QSaveFile file(fileDir);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    // QJsonObject keeps its keys sorted, so frame10 comes before frame2.
+    QList<int> frameOrder(frames.count());
+    std::iota(frameOrder.begin(), frameOrder.end(), 0);
+    std::sort(frameOrder.begin(), frameOrder.end(), [](int a, int b){return frameKey(a) < frameKey(b);});
+
+    // Every channel value is written the same way many times over, so format each just once.
+    QByteArray channelText[256];
+    for (int value = 0; value < 256; value++)
+        channelText[value] = QByteArray(20, ' ') + QByteArray::number(value);
+
+    QByteArray text = "{\n";
+    bool written = true;
+    auto flush = [&]()
+    {
+        written = written && file.write(text) == text.size();
+        text.resize(0);
+    };
+
+    // Durations are only written when some frame is held for more than one tick.
+    if (std::any_of(durations.begin(), durations.end(), [](int duration){return duration != 1;}))
+    {
+        text += "    \"frameDurations\": [\n";
+        for (int i = 0; i < durations.count(); i++)
+        {
+            text += "        " + QByteArray::number(durations[i]);
+            text += i + 1 < durations.count() ? ",\n" : "\n";
+        }
+        text += "    ],\n";
+    }
+
+    text += "    \"frames\": {\n";
+    for (int i = 0; i < frameOrder.count(); i++)
+    {
+        const QImage& frame = frames.at(frameOrder[i]);
+        text += "        \"" + frameKey(frameOrder[i]) + "\": [\n";
+        for (int y = 0; y < canvasSize; y++)
+        {
+            text += "            [\n";
+            const QRgb* line = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+            for (int x = 0; x < canvasSize; x++)
+            {
+                text += "                [\n";
+                text += channelText[qRed(line[x])];
+                text += ",\n";
+                text += channelText[qGreen(line[x])];
+                text += ",\n";
+                text += channelText[qBlue(line[x])];
+                text += ",\n";
+                text += channelText[qAlpha(line[x])];
+                text += "\n";
+                text += x + 1 < canvasSize ? "                ],\n" : "                ]\n";
+            }
+            text += y + 1 < canvasSize ? "            ],\n" : "            ]\n";
+
+            if (text.size() >= WRITE_BUFFER_SIZE)
+                flush();
+        }
+        text += i + 1 < frameOrder.count() ? "        ],\n" : "        ]\n";
+
+        if (progress && !progress(i + 1, frameOrder.count()))
+            return false;
+    }
+    text += "    },\n";
+
+    text += "    \"height\": " + QByteArray::number(canvasSize) + ",\n";
+    text += "    \"numberOfFrames\": " + QByteArray::number(frames.count()) + ",\n";
+    text += "    \"width\": " + QByteArray::number(canvasSize) + "\n";
+    text += "}\n";
+    flush();
+
+    return written && file.commit();
+}
+
+/**
+ * @brief JsonSpriteFile::read
+ * Reads frames from a file in the JSON format, in a single pass. Keys may come in any
+ * order, and unknown keys are skipped. A frame that is missing is transparent, and a
+ * referenced frame shares the pixels of the earlier frame it refers to; references are no
+ * longer written, but files saved with them still open whole.
+ *
+ * @param fileDir -- the file directory to read from
+ * @param canvasSize -- set to the side length of the frames, in pixels
+ * @param frames -- set to the frames read
+ * @param durations -- set to the number of ticks each frame is held for, or emptied if the file has none
+ * @param progress -- if set, called with the bytes read so far and the file size after each frame;
+ *                    returning false cancels
+ * @param framesReady -- if set, called once the first frame has been parsed, with the canvas size (the
+ *                       frame's own, if the height isn't read yet), the number of frames (0 if not read yet),
+ *                       and the first frame
+ * @return true if the file is valid JSON with a canvas size, false otherwise
+ *         (in which case no output is changed)
+ */
+bool JsonSpriteFile::read(QString fileDir, int& canvasSize, QList<QImage>& frames, QList<int>& durations,
+                          std::function<bool(qint64, qint64)> progress,
+                          std::function<void(int, int, const QList<QImage>&)> framesReady)
+{
+    QFile file(fileDir);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    JsonTokenizer json(&file);
+    int height = 0;
+    int frameCount = 0;
+    QHash<int, QImage> storedFrames;
+    QHash<int, int> frameRefs;
+    QList<int> frameDurations;
+    QList<QRgb> row;
+
+    if (!json.consume('{'))
+        return false;
+    if (!json.consume('}'))
+    {
+        do
+        {
+            QByteArray key;
+            if (!json.readString(key) || !json.consume(':'))
+                return false;
+
+            bool valid = true;
+            if (key == "height")
+            {
+                valid = json.readInt(height);
+            }
+            else if (key == "numberOfFrames")
+            {
+                valid = json.readInt(frameCount);
+            }
+            else if (key == "frameDurations")
+            {
+                valid = readDurations(json, frameDurations);
+            }
+            else if ((key == "frames" || key == "frameRefs") && json.consume('{'))
+            {
+                if (json.consume('}'))
+                    continue;
+                do
+                {
+                    QByteArray frameName;
+                    if (!json.readString(frameName) || !json.consume(':'))
+                        return false;
+
+                    // A reference only counts if it is a number; a frame of pixels is read in place.
+                    int frameIndex = frameIndexFromKey(frameName);
+                    int c = json.peek();
+                    if (frameIndex < 0 || (key == "frameRefs" && c != '-' && (c < '0' || c > '9')))
+                        valid = json.skipValue();
+                    else if (key == "frameRefs")
+                        valid = json.readInt(frameRefs[frameIndex]);
+                    else
+                        valid = readFramePixels(json, storedFrames[frameIndex], row);
+
+                    // The first frame is handed over at once, fitted to the canvas size if that is known.
+                    if (valid && framesReady && key == "frames" && frameIndex == 0 && !storedFrames[0].isNull())
+                    {
+                        QImage firstFrame = storedFrames[0];
+                        int size = height > 0 ? height : firstFrame.width();
+                        if (firstFrame.width() != size)
+                            firstFrame = firstFrame.copy(0, 0, size, size);
+                        framesReady(size, frameCount, {firstFrame});
+                    }
+
+                    if (valid && progress && !progress(file.pos(), file.size()))
+                        return false;
+                } while (valid && json.consume(','));
+                valid = valid && json.consume('}');
+            }
+            else
+            {
+                valid = json.skipValue();
+            }
+
+            if (!valid)
+                return false;
+        } while (json.consume(','));
+
+        if (!json.consume('}'))
+            return false;
+    }
+
+    if (height <= 0)
+        return false;
+
+    QList<QImage> readFrames;
+    for (int i = 0; i < frameCount; i++)
+    {
+        auto frameRef = frameRefs.constFind(i);
+        if (frameRef != frameRefs.constEnd() && *frameRef >= 0 && *frameRef < i)
+        {
+            readFrames.append(readFrames.at(*frameRef));
+            continue;
+        }
+
+        // Frames were read at the width of their first row; fit them to the canvas size,
+        // padding with transparent pixels.
+        QImage frame = storedFrames.value(i);
+        if (frame.isNull())
+        {
+            frame = QImage(height, height, QImage::Format_ARGB32);
+            frame.fill(Qt::transparent);
+        }
+        else if (frame.width() != height)
+        {
+            frame = frame.copy(0, 0, height, height);
+        }
+        readFrames.append(frame);
+    }
+
+    canvasSize = height;
+    frames = readFrames;
+    durations = frameDurations;
+    return true;
+}
@@ -0,0 +1,44 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the JsonSpriteFile class.
+ */
+
+
+#ifndef JSONSPRITEFILE_H
+#define JSONSPRITEFILE_H
+
+#include <QImage>
+#include <QList>
+#include <QString>
+#include <functional>
+
+
+/**
+ * @brief The JsonSpriteFile class
+ * Reads and writes the JSON sprite format, in which every pixel is an array of its red,
+ * green, blue, and alpha values. Neither direction builds a JSON document in memory:
+ * the writer streams text straight from the frames' scanlines, byte for byte as
+ * QJsonDocument::toJson() lays it out, and the reader parses the text as it arrives,
+ * filling the frames' scanlines directly. The first frame is handed over as soon as it has
+ * been parsed; the rest only once the whole file has been read, since keys sort "frame10"
+ * before "frame2".
+ */
+class JsonSpriteFile
+{
+public:
+    static bool write(QString, int, const QList<QImage>&, const QList<int>&,
+                      std::function<bool(qint64, qint64)> = nullptr);
+    static bool read(QString, int&, QList<QImage>&, QList<int>&, std::function<bool(qint64, qint64)> = nullptr,
+                     std::function<void(int, int, const QList<QImage>&)> = nullptr);
+
+private:
+    static const int WRITE_BUFFER_SIZE = 1 << 16;
+};
+
+#endif // JSONSPRITEFILE_H
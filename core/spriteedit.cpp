@@ -0,0 +1,181 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   March 30, 2023
+ * Style Reviewer   |   Braden Fiedel
+ *
+ * This file contains the implementation of the class definition located in spriteedit.h.
+ */
+
+
+#include "spriteedit.h"
+
+
+/**
+ * @brief SpriteEdit::SpriteEdit
+ * Constructor. Initializes a SpriteEdit object with the given frame index.
+ *
+ * @param parent -- QObject parent object
+ */
+SpriteEdit::SpriteEdit(int frameIndex)
+    : frameIndex{frameIndex}
+{
+
+}
+
+/**
+ * @brief SpriteEdit::addEditComponent
+ * Adds a "component" (an edited pixel) to the current Edit object
+ *
+ * @param editLoc -- the coordinates of the edited pixel, within the canvas
+ * @param previousColor -- the previous color of that pixel, prior to the edit
+ */
+void SpriteEdit::addEditComponent(QPoint editLoc, QColor previousColor, QColor newColor)
+{
+    editComponents.append(tuple(editLoc, previousColor, newColor));
+}
+
+/**
+ * @brief SpriteEdit::addFrameSnapshot
+ * Adds the before and after pixels of a region of a frame to the current Edit object.
+ *
+ * @param snapshotFrameIndex -- the index of the frame the region belongs to
+ * @param rect -- the region, within the canvas
+ * @param before -- the pixels of the region prior to the edit
+ * @param after -- the pixels of the region after the edit
+ * @param colorChange -- the change in color counts from before to after
+ */
+void SpriteEdit::addFrameSnapshot(int snapshotFrameIndex, QRect rect, QImage before, QImage after, ColorHistogram colorChange)
+{
+    frameSnapshots.append(FrameSnapshot{snapshotFrameIndex, rect, before, after, colorChange});
+}
+
+/**
+ * @brief SpriteEdit::isEmpty
+ *
+ * @return whether this SpriteEdit contains any edit components
+ */
+bool SpriteEdit::isEmpty()
+{
+    return editComponents.isEmpty() && frameSnapshots.isEmpty();
+}
+
+/**
+ * @brief SpriteEdit::getComponents
+ *
+ * @return the QList of components that make up this Edit
+ */
+QList<tuple<QPoint, QColor, QColor>> SpriteEdit::getComponents()
+{
+    return editComponents;
+}
+
+/**
+ * @brief SpriteEdit::getFrameSnapshots
+ *
+ * @return the QList of region snapshots that make up this Edit
+ */
+QList<SpriteEdit::FrameSnapshot> SpriteEdit::getFrameSnapshots()
+{
+    return frameSnapshots;
+}
+
+/**
+ * @brief SpriteEdit::getByteCount
+ * Snapshots usually share their pixels with a frame or another edit, so each pixel buffer
+ * is only counted if it hasn't been already, by its QImage cache key.
+ *
+ * @param countedBuffers -- the cache keys of the buffers already counted, which this Edit's are added to
+ * @return the approximate number of bytes this Edit holds in memory
+ */
+qint64 SpriteEdit::getByteCount(QSet<qint64>& countedBuffers)
+{
+    qint64 byteCount = sizeof(SpriteEdit) + editComponents.capacity() * sizeof(tuple<QPoint, QColor, QColor>);
+    for (const FrameSnapshot& snapshot : frameSnapshots)
+    {
+        byteCount += sizeof(FrameSnapshot);
+        for (const QImage* image : {&snapshot.before, &snapshot.after})
+        {
+            if (!countedBuffers.contains(image->cacheKey()))
+            {
+                countedBuffers.insert(image->cacheKey());
+                byteCount += image->sizeInBytes();
+            }
+        }
+    }
+    return byteCount;
+}
+
+/**
+ * @brief SpriteEdit::getFrameIndex
+ *
+ * @return the index of the frame that this Edit pertains to
+ */
+int SpriteEdit::getFrameIndex()
+{
+    return frameIndex;
+}
+
+/**
+ * @brief SpriteEdit::getFrameIndices
+ *
+ * @return the indices of every frame that this Edit changes, without repeats
+ */
+QList<int> SpriteEdit::getFrameIndices()
+{
+    QList<int> frameIndices;
+    if (!editComponents.isEmpty())
+        frameIndices.append(frameIndex);
+    for (const FrameSnapshot& snapshot : frameSnapshots)
+        if (!frameIndices.contains(snapshot.frameIndex))
+            frameIndices.append(snapshot.frameIndex);
+    return frameIndices;
+}
+
+/**
+ * @brief SpriteEdit::frameInserted
+ * Shifts this Edit's frame indices to account for a frame inserted before them.
+ *
+ * @param insertedFrameIndex -- the index at which the new frame was inserted
+ */
+void SpriteEdit::frameInserted(int insertedFrameIndex)
+{
+    if (frameIndex >= insertedFrameIndex)
+        frameIndex++;
+    for (FrameSnapshot& snapshot : frameSnapshots)
+        if (snapshot.frameIndex >= insertedFrameIndex)
+            snapshot.frameIndex++;
+}
+
+/**
+ * @brief SpriteEdit::frameRemoved
+ * Discards the parts of this Edit on a removed frame, and shifts the frame indices after it.
+ *
+ * @param removedFrameIndex -- the index from which the frame was removed
+ */
+void SpriteEdit::frameRemoved(int removedFrameIndex)
+{
+    discardFrame(removedFrameIndex);
+
+    if (frameIndex > removedFrameIndex)
+        frameIndex--;
+    for (FrameSnapshot& snapshot : frameSnapshots)
+        if (snapshot.frameIndex > removedFrameIndex)
+            snapshot.frameIndex--;
+}
+
+/**
+ * @brief SpriteEdit::discardFrame
+ * Discards the parts of this Edit on the given frame, leaving the frame indices as they are.
+ *
+ * @param discardedFrameIndex -- the index of the frame whose changes to discard
+ */
+void SpriteEdit::discardFrame(int discardedFrameIndex)
+{
+    if (frameIndex == discardedFrameIndex)
+        editComponents.clear();
+    frameSnapshots.removeIf([discardedFrameIndex](const FrameSnapshot& snapshot)
+                            {return snapshot.frameIndex == discardedFrameIndex;});
+}
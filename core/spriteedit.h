@@ -13,8 +13,12 @@
 #ifndef SPRITEEDIT_H
 #define SPRITEEDIT_H
 
+#include "colorhistogram.h"
+#include <QImage>
 #include <QObject>
 #include <QPoint>
+#include <QRect>
+#include <QSet>
 #include "qcolor.h"
 
 using std::tuple;
@@ -25,22 +29,45 @@ using std::tuple;
  * This class represents an "edit" made in the sprite editor. Objects of this class
  * are used to enable undo/redo functionality in the editor, and store data about
  * each pixel affected by the edit, as well as the frame in which the edit took place.
+ * Edits that change whole regions of frames at once instead store before and after
+ * snapshots of each region; the snapshots share their pixels with the frames until
+ * either is drawn on, so they cost almost nothing to take. Each snapshot also records how
+ * the edit changes the count of each color, so undo and redo never have to recount pixels.
  */
 class SpriteEdit
 {
 public:
+    /**
+     * The pixels of a region of one frame, before and after the edit, and the change in
+     * color counts from before to after.
+     */
+    struct FrameSnapshot
+    {
+        int frameIndex;
+        QRect rect;
+        QImage before;
+        QImage after;
+        ColorHistogram colorChange;
+    };
+
     explicit SpriteEdit(int);
     void addEditComponent(QPoint, QColor, QColor);
+    void addFrameSnapshot(int, QRect, QImage, QImage, ColorHistogram);
     bool isEmpty();
     int getFrameIndex();
-    void incrementFrameIndex();
-    void decrementFrameIndex();
+    QList<int> getFrameIndices();
+    void frameInserted(int);
+    void frameRemoved(int);
+    void discardFrame(int);
     QList<tuple<QPoint, QColor, QColor>> getComponents();
+    QList<FrameSnapshot> getFrameSnapshots();
+    qint64 getByteCount(QSet<qint64>&);
 
 
 private:
     int frameIndex;
     QList<tuple<QPoint, QColor, QColor>> editComponents;
+    QList<FrameSnapshot> frameSnapshots;
 
 };
 
@@ -0,0 +1,2524 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   April 5, 2023
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the implementation of the class definition located in spriteeditormodel.h.
+ */
+
+
+#include "spriteeditormodel.h"
+#include "apngencoder.h"
+#include "colorquantizer.h"
+#include "compressedspritefile.h"
+#include "frametransforms.h"
+#include "gifencoder.h"
+#include "jsonspritefile.h"
+#include "spritesheetexporter.h"
+#include "tracer.h"
+#include <QCollator>
+#include <QSet>
+#include <QTimer>
+#include <QtConcurrent>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+
+
+/**
+ * @brief reportProgressTo
+ * Adapts a background task's promise into the progress callback taken by the file formats.
+ *
+ * @param promise -- the promise to report percentages to
+ * @return a callback that reports the fraction done as a percentage, and returns false once the task is cancelled
+ */
+template <typename T>
+static std::function<bool(qint64, qint64)> reportProgressTo(QPromise<T>& promise)
+{
+    return [&promise](qint64 done, qint64 total)
+    {
+        promise.setProgressValue(int(done * 100 / qMax<qint64>(total, 1)));
+        return !promise.isCanceled();
+    };
+}
+
+
+/**
+ * @brief SpriteEditorModel::SpriteEditorModel
+ * Constructor. Creates a new SpriteEditorModel object, using
+ * default values (for now).
+ *
+ * @param parent -- QObject parent object
+ */
+SpriteEditorModel::SpriteEditorModel(QObject* parent)
+    : QObject{parent}
+    , numFrames{0}
+    , currentFrameIndex{0}
+    , animationRunning{false}
+    , currentEdit{SpriteEdit(0)}
+{
+    // Start with the default brush color (black) as the only recent color.
+    resetRecentColors();
+
+    // Set up a timer to animate the preview frame. It only wakes when the next frame is due.
+    timer = new QTimer(this);
+    timer->setSingleShot(true);
+    timer->setTimerType(Qt::PreciseTimer);
+
+    connect(timer, &QTimer::timeout,
+            this, &SpriteEditorModel::animatePreviewFrame);
+
+    // Set up a watcher to report on animation exports running in the background
+    exportWatcher = new QFutureWatcher<bool>(this);
+    connect(exportWatcher, &QFutureWatcher<bool>::progressValueChanged,
+            this, [this](int framesEncoded){emit animationExportProgress(framesEncoded, exportWatcher->progressMaximum());});
+    connect(exportWatcher, &QFutureWatcher<bool>::finished,
+            this, [this](){emit animationExportFinished(exportWatcher->future().resultCount() > 0 && exportWatcher->result());});
+
+    // Set up watchers to report on files opened and saved in the background. A cancelled
+    // operation finishes as a failure, even if its result arrived first. Frames of a file
+    // being opened are placed in the sprite as they arrive.
+    saveWatcher = new QFutureWatcher<bool>(this);
+    connect(saveWatcher, &QFutureWatcher<bool>::progressValueChanged,
+            this, &SpriteEditorModel::fileOperationProgress);
+    connect(saveWatcher, &QFutureWatcher<bool>::finished, this, [this]()
+    {
+        bool saved = !saveWatcher->isCanceled() && saveWatcher->future().resultCount() > 0 && saveWatcher->result();
+        if (saved)
+            saveDir = fileOperationDir;
+        emit fileOperationFinished(saved);
+    });
+    openWatcher = new QFutureWatcher<LoadedDocument>(this);
+    connect(openWatcher, &QFutureWatcher<LoadedDocument>::progressValueChanged,
+            this, &SpriteEditorModel::fileOperationProgress);
+    connect(openWatcher, &QFutureWatcher<LoadedDocument>::resultReadyAt,
+            this, &SpriteEditorModel::receiveLoadedFrames);
+    connect(openWatcher, &QFutureWatcher<LoadedDocument>::finished, this, [this]()
+    {
+        receiveLoadedFrames(openWatcher->future().resultCount() - 1);
+        finishLoading();
+        emit fileOperationFinished(documentLoaded);
+    });
+
+    // A memory budget can be set for every instance on a machine, in megabytes.
+    memoryBudget = qEnvironmentVariableIntValue("SPRITE_EDITOR_MEMORY_BUDGET_MB") * qint64(1024 * 1024);
+}
+
+
+// ===================================================
+// ===             SETTERS AND GETTERS             ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::setCanvasSize
+ * Sets the side length (size) of the canvas to the given size in QImage "pixels"
+ *
+ * @param size -- the value to which to set the canvas side length (size)
+ */
+void SpriteEditorModel::setCanvasSize(int size)
+{
+    canvasSize = size;
+}
+
+/**
+ * @brief SpriteEditorModel::getCanvasSize
+ *
+ * @return the side length (size) of the canvas, in QImage "pixels"
+ */
+int SpriteEditorModel::getCanvasSize()
+{
+    return canvasSize;
+}
+
+/**
+ * @brief SpriteEditorModel::setCurrentColor
+ *
+ * @param color -- the new color of the drawing tool
+ */
+void SpriteEditorModel::setCurrentColor(QColor color)
+{
+    currentColor = color;
+}
+
+/**
+ * @brief SpriteEditorModel::getCurrentColor
+ *
+ * @return the current color of the drawing tool
+ */
+QColor SpriteEditorModel::getCurrentColor()
+{
+    return currentColor;
+}
+
+/**
+ * @brief SpriteEditorModel::getCurrentFrameIndex
+ *
+ * @return the index of the currently active frame
+ */
+int SpriteEditorModel::getCurrentFrameIndex()
+{
+    return currentFrameIndex;
+}
+
+/**
+ * @brief SpriteEditorModel::getFrame
+ *
+ * @param frameIndex -- the index of the frame to get
+ * @return a pointer to the frame of the given index
+ */
+QImage* SpriteEditorModel::getFrame(int frameIndex)
+{
+    return &frames[frameIndex];
+}
+
+/**
+ * @brief SpriteEditorModel::getFrameCount
+ *
+ * @return the number of frames in the sprite
+ */
+int SpriteEditorModel::getFrameCount()
+{
+    return numFrames;
+}
+
+/**
+ * @brief SpriteEditorModel::getLoadedFrameCount
+ * While a file is still being opened, only its leading frames have been read; the rest are
+ * transparent placeholders.
+ *
+ * @return the number of frames, from the first, whose pixels are in the sprite
+ */
+int SpriteEditorModel::getLoadedFrameCount()
+{
+    return loadingFrames ? loadedFrameCount : numFrames;
+}
+
+/**
+ * @brief SpriteEditorModel::isLoadingFrames
+ *
+ * @return true while placeholders stand in for frames of a file still being read
+ */
+bool SpriteEditorModel::isLoadingFrames()
+{
+    return loadingFrames;
+}
+
+/**
+ * @brief SpriteEditorModel::getFrameHash
+ * Hashes the pixels of a frame. Hashes are cached by the frame's QImage cache key, which
+ * changes whenever the frame is drawn on, so a cached hash is never stale.
+ *
+ * @param frameIndex -- the index of the frame to hash
+ * @return the content hash of the frame
+ */
+size_t SpriteEditorModel::getFrameHash(int frameIndex)
+{
+    const QImage& frame = frames.at(frameIndex);
+    auto cached = frameHashes.constFind(frame.cacheKey());
+    if (cached != frameHashes.constEnd())
+        return *cached;
+
+    size_t hash = qHashBits(frame.constBits(), frame.sizeInBytes());
+    frameHashes.insert(frame.cacheKey(), hash);
+    return hash;
+}
+
+/**
+ * @brief SpriteEditorModel::getFramesByteCount
+ *
+ * @return the number of bytes of pixel data held by the frames, counting shared frames once
+ */
+qint64 SpriteEditorModel::getFramesByteCount()
+{
+    qint64 byteCount = 0;
+    QSet<qint64> countedFrames;
+    for (const QImage& frame : frames)
+    {
+        if (!countedFrames.contains(frame.cacheKey()))
+        {
+            countedFrames.insert(frame.cacheKey());
+            byteCount += frame.sizeInBytes();
+        }
+    }
+    return byteCount;
+}
+
+/**
+ * @brief SpriteEditorModel::shareIdenticalFrames
+ * Makes frames with identical pixels share one buffer. Hashes narrow down the candidates
+ * before pixels are compared. A shared frame is copied the first time it is drawn on, so
+ * the sharing is invisible to everything that edits frames.
+ *
+ * @return for each frame, the index of the first frame with identical pixels (its own index if none)
+ */
+QList<int> SpriteEditorModel::shareIdenticalFrames()
+{
+    QList<int> originalFrames(numFrames);
+    QHash<size_t, QList<int>> framesByHash;
+    QHash<qint64, size_t> liveHashes;
+
+    for (int i = 0; i < numFrames; i++)
+    {
+        size_t hash = getFrameHash(i);
+        originalFrames[i] = i;
+
+        QList<int>& candidates = framesByHash[hash];
+        for (int candidate : candidates)
+        {
+            if (frames.at(candidate) == frames.at(i))
+            {
+                originalFrames[i] = candidate;
+                break;
+            }
+        }
+
+        if (originalFrames[i] == i)
+            candidates.append(i);
+        else if (frames.at(i).cacheKey() != frames.at(originalFrames[i]).cacheKey())
+            frames[i] = frames.at(originalFrames[i]);
+
+        liveHashes.insert(frames.at(i).cacheKey(), hash);
+    }
+
+    // Drop the hashes of frames that have since been drawn on or removed.
+    frameHashes = liveHashes;
+    return originalFrames;
+}
+
+/**
+ * @brief SpriteEditorModel::getHistoryByteCount
+ *
+ * @return the approximate number of bytes held by the undo and redo stacks, not counting
+ *         pixels they share with the frames or with each other
+ */
+qint64 SpriteEditorModel::getHistoryByteCount()
+{
+    QSet<qint64> countedBuffers;
+    for (const QImage& frame : frames)
+        countedBuffers.insert(frame.cacheKey());
+
+    qint64 byteCount = 0;
+    for (SpriteEdit& edit : edits)
+        byteCount += edit.getByteCount(countedBuffers);
+    for (SpriteEdit& edit : undoneEdits)
+        byteCount += edit.getByteCount(countedBuffers);
+    return byteCount;
+}
+
+/**
+ * @brief SpriteEditorModel::getMemoryUsage
+ * Measures the frames, the undo/redo stacks, the model's own frame hashes, and every cache
+ * reported by addCacheReporter.
+ *
+ * @return the approximate number of bytes held by each
+ */
+SpriteEditorModel::MemoryUsage SpriteEditorModel::getMemoryUsage()
+{
+    MemoryUsage usage;
+    usage.frameBytes = getFramesByteCount();
+    usage.historyBytes = getHistoryByteCount();
+    usage.cacheBytes.insert("Frame hashes", frameHashes.size() * qint64(sizeof(qint64) + sizeof(size_t)));
+    for (const CacheReporter& reporter : cacheReporters)
+        if (!reporter.owner.isNull())
+            usage.cacheBytes[reporter.name] += reporter.byteCount();
+
+    usage.totalBytes = usage.frameBytes + usage.historyBytes;
+    for (qint64 cacheBytes : usage.cacheBytes)
+        usage.totalBytes += cacheBytes;
+    return usage;
+}
+
+/**
+ * @brief SpriteEditorModel::getMemoryBudget
+ *
+ * @return the number of bytes the document may hold before caches and history are dropped,
+ *         or 0 if there is no budget
+ */
+qint64 SpriteEditorModel::getMemoryBudget()
+{
+    return memoryBudget;
+}
+
+/**
+ * @brief SpriteEditorModel::addCacheReporter
+ * Adds a cache to the memory accounting. The cache is emptied, before any history is
+ * dropped, when the document goes over its memory budget.
+ *
+ * @param owner -- the object holding the cache; the cache is forgotten once it is destroyed
+ * @param name -- the name the cache is reported under
+ * @param byteCount -- returns the number of bytes the cache holds
+ * @param evict -- empties the cache
+ */
+void SpriteEditorModel::addCacheReporter(QObject* owner, QString name, std::function<qint64()> byteCount,
+                                         std::function<void()> evict)
+{
+    cacheReporters.append({owner, name, byteCount, evict});
+}
+
+/**
+ * @brief SpriteEditorModel::getDocumentColors
+ *
+ * @return the number of pixels of each color, across every frame
+ */
+ColorHistogram SpriteEditorModel::getDocumentColors()
+{
+    return documentHistogram;
+}
+
+/**
+ * @brief SpriteEditorModel::getFrameColors
+ *
+ * @param frameIndex -- the index of the frame
+ * @return the number of pixels of each color in the frame
+ */
+ColorHistogram SpriteEditorModel::getFrameColors(int frameIndex)
+{
+    return frameHistograms.at(frameIndex);
+}
+
+/**
+ * @brief SpriteEditorModel::getDocumentPalette
+ * The document palette holds every visible color that has been drawn with or picked since
+ * the sprite was opened, in the order they first appeared. Colors stay in the palette after
+ * their last pixel is gone, so that they can be reported as unused.
+ *
+ * @return the colors of the document palette
+ */
+QList<QRgb> SpriteEditorModel::getDocumentPalette()
+{
+    return documentPalette;
+}
+
+/**
+ * @brief SpriteEditorModel::getTool
+ *
+ * @return the tool that is currently active
+ */
+SpriteEditorModel::Tool SpriteEditorModel::getTool()
+{
+    return currentTool;
+}
+
+/**
+ * @brief SpriteEditorModel::getFrameDuration
+ *
+ * @param frameIndex -- the index of the frame
+ * @return the number of animation ticks the frame is held for
+ */
+int SpriteEditorModel::getFrameDuration(int frameIndex)
+{
+    return frameDurations.at(frameIndex);
+}
+
+// ===================================================
+// ===              FILE MANIPULATION              ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::saveFile
+ * Attempts to save a file at the specified directory, waiting until it is written. Nothing
+ * is saved while the frames of a file being opened are still being read.
+ *
+ * @param fileDir -- the file directory at which a file is to be saved.
+ */
+void SpriteEditorModel::saveFile(QString fileDir)
+{
+    TRACE_SCOPE("saveFile");
+
+    // The placeholders of a file still being opened would be written in place of its frames.
+    if (loadingFrames)
+        return;
+
+    commitSelection();
+    QList<int> originalFrames = shareIdenticalFrames();
+    if (writeDocument(fileDir, canvasSize, frames, originalFrames, frameDurations, nullptr))
+        saveDir = fileDir;
+}
+
+/**
+ * @brief SpriteEditorModel::openFile
+ * Attempts to open a file at the specified directory, waiting until it is read. Compressed
+ * files are recognized by their header, whatever their name; anything else is read as JSON.
+ *
+ * @param fileDir -- the file directory at which a file is to be opened.
+ */
+void SpriteEditorModel::openFile(QString fileDir)
+{
+    TRACE_SCOPE("openFile");
+
+    // Stop any file still being opened in the background, without waiting for it, then leave
+    // the current sprite alone if the file holds no frames.
+    openWatcher->cancel();
+    finishLoading();
+    LoadedDocument document;
+    if (readDocument(fileDir, document, nullptr, nullptr))
+        installDocument(fileDir, document);
+}
+
+/**
+ * @brief SpriteEditorModel::saveFileAsync
+ * Starts saving a file at the specified directory in the background. The frames are written
+ * as they are now; drawing while the save runs copies the edited frame rather than changing
+ * the one being written. Progress is reported with fileOperationProgress, and completion
+ * with fileOperationFinished.
+ *
+ * @param fileDir -- the file directory at which a file is to be saved.
+ * @return true if the save started, false if another file is still being opened or saved
+ */
+bool SpriteEditorModel::saveFileAsync(QString fileDir)
+{
+    if (isFileOperationRunning())
+        return false;
+
+    commitSelection();
+    QList<int> originalFrames = shareIdenticalFrames();
+    QList<QImage> frameSnapshot = frames;
+    QList<int> durations = frameDurations;
+    int size = canvasSize;
+
+    fileOperationDir = fileDir;
+    emit fileOperationStarted(fileDir, false);
+    saveWatcher->setFuture(QtConcurrent::run([fileDir, size, frameSnapshot, originalFrames, durations](QPromise<bool>& promise)
+    {
+        promise.setProgressRange(0, 100);
+        promise.addResult(writeDocument(fileDir, size, frameSnapshot, originalFrames, durations,
+                                        reportProgressTo(promise)));
+    }));
+    return true;
+}
+
+/**
+ * @brief SpriteEditorModel::openFileAsync
+ * Starts opening a file at the specified directory in the background. The open sprite stays
+ * as it is, and can still be edited, until the first frame has been read; then it is replaced
+ * in a single step, with a placeholder for each frame still to come. The remaining frames
+ * replace their placeholders as they are read. While placeholders remain, the frames read so
+ * far can be drawn on, but anything that adds, removes, or changes every frame is refused;
+ * frameLoadingChanged tells the view when that starts and stops. If the read fails or is
+ * cancelled before the first frame arrives, the open sprite is kept; if it fails or is
+ * cancelled after, the frames read so far are kept. Progress is reported with
+ * fileOperationProgress, and completion with fileOperationFinished.
+ *
+ * @param fileDir -- the file directory at which a file is to be opened.
+ * @return true if the open started, false if another file is still being opened or saved
+ */
+bool SpriteEditorModel::openFileAsync(QString fileDir)
+{
+    if (isFileOperationRunning())
+        return false;
+
+    fileOperationDir = fileDir;
+    receivedLoadResults = 0;
+    documentLoaded = false;
+    emit fileOperationStarted(fileDir, true);
+    openWatcher->setFuture(QtConcurrent::run([fileDir](QPromise<LoadedDocument>& promise)
+    {
+        promise.setProgressRange(0, 100);
+
+        // Hand over the frames that are ready ahead of the rest, a batch at a time.
+        int framesHandedOver = 0;
+        auto framesReady = [&promise, &framesHandedOver](int size, int frameCount, const QList<QImage>& readyFrames)
+        {
+            LoadedDocument batch;
+            batch.canvasSize = size;
+            batch.frameCount = frameCount;
+            batch.firstFrame = framesHandedOver;
+            batch.frames = readyFrames.mid(framesHandedOver);
+            framesHandedOver = readyFrames.count();
+            promise.addResult(batch);
+        };
+
+        LoadedDocument document;
+        if (readDocument(fileDir, document, reportProgressTo(promise), framesReady))
+        {
+            document.complete = true;
+            promise.addResult(document);
+        }
+    }));
+    return true;
+}
+
+/**
+ * @brief SpriteEditorModel::isFileOperationRunning
+ *
+ * @return true if a file is being opened or saved in the background
+ */
+bool SpriteEditorModel::isFileOperationRunning()
+{
+    return saveWatcher->isRunning() || openWatcher->isRunning();
+}
+
+/**
+ * @brief SpriteEditorModel::cancelFileOperation
+ * Cancels the file being opened or saved in the background, if any. A cancelled open keeps
+ * the current sprite, and a cancelled save leaves any existing file as it was.
+ */
+void SpriteEditorModel::cancelFileOperation()
+{
+    saveWatcher->cancel();
+    openWatcher->cancel();
+}
+
+/**
+ * @brief SpriteEditorModel::writeDocument
+ * Writes a sprite in the format its file name calls for. Touches no model state, so it can
+ * run on any thread.
+ *
+ * @param fileDir -- the file directory at which to write
+ * @param size -- the side length of the frames, in pixels
+ * @param documentFrames -- the frames to write
+ * @param originalFrames -- for each frame, the index of the first frame with identical pixels (its own index
+ *                          if none); only compressed files write references to them
+ * @param durations -- the number of animation ticks each frame is held for
+ * @param progress -- if set, called as the write goes; returning false cancels
+ * @return true if the whole file was written, false otherwise
+ */
+bool SpriteEditorModel::writeDocument(QString fileDir, int size, const QList<QImage>& documentFrames,
+                                      const QList<int>& originalFrames, const QList<int>& durations,
+                                      std::function<bool(qint64, qint64)> progress)
+{
+    // Compressed files store each frame as its own zlib chunk, compressed concurrently.
+    if (fileDir.endsWith(CompressedSpriteFile::FILE_SUFFIX))
+        return CompressedSpriteFile::write(fileDir, size, documentFrames, originalFrames, durations, progress);
+
+    // JSON files keep every frame's pixels, so that readers that don't know frame references lose nothing.
+    return JsonSpriteFile::write(fileDir, size, documentFrames, durations, progress);
+}
+
+/**
+ * @brief SpriteEditorModel::readDocument
+ * Reads a sprite from a file, trying the compressed format first. Touches no model state,
+ * so it can run on any thread.
+ *
+ * @param fileDir -- the file directory to read from
+ * @param document -- set to the sprite read
+ * @param progress -- if set, called as the read goes; returning false cancels
+ * @param framesReady -- if set, called with the canvas size, the frame count (0 if not yet known),
+ *                       and the leading frames read so far, whenever more are ready ahead of the rest
+ * @return true if the file holds at least one frame and was read whole, false otherwise
+ */
+bool SpriteEditorModel::readDocument(QString fileDir, LoadedDocument& document,
+                                     std::function<bool(qint64, qint64)> progress,
+                                     std::function<void(int, int, const QList<QImage>&)> framesReady)
+{
+    if (!CompressedSpriteFile::read(fileDir, document.canvasSize, document.frames, document.durations,
+                                    progress, framesReady)
+        && !JsonSpriteFile::read(fileDir, document.canvasSize, document.frames, document.durations,
+                                 progress, framesReady))
+        return false;
+    return !document.frames.isEmpty();
+}
+
+/**
+ * @brief SpriteEditorModel::installDocument
+ * Replaces the open sprite with one read from a file, resetting the animation, selection,
+ * colors, and undo history along with it.
+ *
+ * @param fileDir -- the file directory the sprite was read from
+ * @param document -- the sprite read
+ */
+void SpriteEditorModel::installDocument(QString fileDir, const LoadedDocument& document)
+{
+    TRACE_SCOPE("installDocument");
+
+    // End the animation.
+    timer->stop();
+    animationRunning = false;
+    animationIndex = 0;
+    animationTick = 0;
+
+    // Drop any selection, floating or not; it belongs to the sprite being replaced.
+    resetSelection();
+
+    // Set the canvas size from the file.
+    canvasSize = document.canvasSize;
+    emit canvasSizeChanged();
+
+    // Remove the old frames.
+    int oldFrameCount = numFrames;
+    for (int i = 0; i < oldFrameCount - 1; i++)
+        deleteCurrentFrame();
+
+    // Replace the first frame, then add the rest in a single batch. The undo history is
+    // cleared below, so no edit indices need adjusting.
+    frames[0] = document.frames.first();
+    frames.append(document.frames.mid(1));
+    numFrames = frames.count();
+
+    // Files without durations hold every frame for a single tick.
+    frameDurations.fill(1, numFrames);
+    for (int i = 0; i < qMin(numFrames, document.durations.count()); i++)
+        frameDurations[i] = qMax(1, document.durations[i]);
+    playbackTimeline.clear();
+
+    // JSON files, and compressed files with no references, may still hold identical frames.
+    shareIdenticalFrames();
+    resetColorCounts();
+
+    TRACE_SIGNAL("frameUpdated", emit frameUpdated(0));
+    emit frameDurationChanged(0);
+    if (numFrames > 1)
+        emit framesInserted(1, numFrames - 1);
+
+    // Set focus to the first frame and refresh the drawing canvas
+    currentFrameIndex = 0;
+    TRACE_SIGNAL("setFocusToIndex", emit setFocusToIndex(currentFrameIndex));
+
+    // Reset the recent colors, palette, and tool.
+    resetRecentColors();
+    emit resetColorPalette();
+    setTool(PEN);
+
+    // Update the stored save directory.
+    saveDir = fileDir;
+
+    // Clear undo/redo stacks.
+    edits.clear();
+    undoneEdits.clear();
+
+    // Reset the animation preview.
+    emit resetPreview();
+    enforceMemoryBudget();
+}
+
+/**
+ * @brief SpriteEditorModel::receiveLoadedFrames
+ * Places the frames handed over by the file being opened, up to and including the given
+ * result, in the order they were read. The first frames replace the open sprite, followed by
+ * a placeholder for each frame still to come; later frames replace their placeholders. Results
+ * already placed are skipped, so each is placed once however it is delivered.
+ *
+ * @param resultIndex -- the index of the last result to place
+ */
+void SpriteEditorModel::receiveLoadedFrames(int resultIndex)
+{
+    if (openWatcher->isCanceled())
+        return;
+
+    for (; receivedLoadResults <= resultIndex; receivedLoadResults++)
+    {
+        LoadedDocument batch = openWatcher->resultAt(receivedLoadResults);
+        if (batch.complete && (!loadingFrames || batch.canvasSize != canvasSize || batch.frames.count() < numFrames))
+        {
+            // Nothing was shown ahead of the rest, or what was shown doesn't fit the file after all.
+            setLoadingFrames(false);
+            installDocument(fileOperationDir, batch);
+        }
+        else if (batch.complete)
+        {
+            TRACE_SCOPE("finishDocument");
+
+            placeLoadedFrames(loadedFrameCount, batch.frames.mid(loadedFrameCount));
+            setLoadingFrames(false);
+
+            // Durations come last in a file, so every frame was held for a single tick until now.
+            for (int i = 0; i < qMin(numFrames, batch.durations.count()); i++)
+            {
+                if (batch.durations[i] <= 1)
+                    continue;
+                frameDurations[i] = batch.durations[i];
+                emit frameDurationChanged(i);
+            }
+            playbackTimeline.clear();
+        }
+        else if (!loadingFrames)
+        {
+            TRACE_SCOPE("showFirstFrames");
+
+            // All the placeholders share one buffer, so they cost a single frame between them.
+            LoadedDocument firstFrames = batch;
+            QImage placeholder(batch.canvasSize, batch.canvasSize, QImage::Format_ARGB32);
+            placeholder.fill(Qt::transparent);
+            while (firstFrames.frames.count() < batch.frameCount)
+                firstFrames.frames.append(placeholder);
+
+            installDocument(fileOperationDir, firstFrames);
+            loadedFrameCount = batch.frames.count();
+            setLoadingFrames(true);
+            playbackTimeline.clear();
+        }
+        else
+        {
+            placeLoadedFrames(batch.firstFrame, batch.frames);
+        }
+        documentLoaded = batch.complete;
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::placeLoadedFrames
+ * Puts frames read from the file being opened in place of their placeholders, adding frames
+ * at the end for any whose number wasn't known up front. Their colors are counted concurrently.
+ *
+ * @param firstFrameIndex -- the index of the first frame to place
+ * @param loadedFrames -- the frames to place, in order
+ */
+void SpriteEditorModel::placeLoadedFrames(int firstFrameIndex, QList<QImage> loadedFrames)
+{
+    if (loadedFrames.isEmpty())
+        return;
+
+    // Frames are only added at the end, so no edit indices shift.
+    int extraFrames = firstFrameIndex + loadedFrames.count() - numFrames;
+    if (extraFrames > 0)
+    {
+        int firstNewIndex = numFrames;
+        QImage placeholder(canvasSize, canvasSize, QImage::Format_ARGB32);
+        placeholder.fill(Qt::transparent);
+        frames.append(QList<QImage>(extraFrames, placeholder));
+        frameDurations.append(QList<int>(extraFrames, 1));
+        frameHistograms.append(QList<ColorHistogram>(extraFrames, ColorHistogram()));
+        numFrames += extraFrames;
+        emit framesInserted(firstNewIndex, extraFrames);
+    }
+
+    QList<ColorHistogram> loadedColors = countFrameColors(loadedFrames);
+    for (int i = 0; i < loadedFrames.count(); i++)
+    {
+        int frameIndex = firstFrameIndex + i;
+        frames[frameIndex] = loadedFrames[i];
+        setFrameColors(frameIndex, loadedColors[i]);
+        emit frameUpdated(frameIndex);
+    }
+    emit documentPaletteChanged();
+
+    loadedFrameCount = qMax(loadedFrameCount, firstFrameIndex + int(loadedFrames.count()));
+    playbackTimeline.clear();
+}
+
+/**
+ * @brief SpriteEditorModel::finishLoading
+ * Places the rest of the frames of a file being opened, once its read has finished or been
+ * cancelled; never waits for it. If the read failed or was cancelled, the placeholders are
+ * removed, leaving the frames read so far; the save directory is then forgotten, so that
+ * saving can't cut the file short.
+ */
+void SpriteEditorModel::finishLoading()
+{
+    if (!loadingFrames)
+        return;
+
+    TRACE_SCOPE("finishLoading");
+
+    receiveLoadedFrames(openWatcher->future().resultCount() - 1);
+    if (!loadingFrames)
+        return;
+
+    // Placeholders are never drawn on, so no edits refer to them.
+    setLoadingFrames(false);
+    while (numFrames > loadedFrameCount)
+    {
+        int removedFrameIndex = numFrames - 1;
+        setFrameColors(removedFrameIndex, ColorHistogram());
+        frames.removeLast();
+        frameDurations.removeLast();
+        frameHistograms.removeLast();
+        numFrames--;
+        emit frameRemoved(removedFrameIndex);
+    }
+    playbackTimeline.clear();
+    saveDir = QString();
+    emit documentPaletteChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::setLoadingFrames
+ * Records whether a file's frames are still being read, and tells the view when that changes.
+ *
+ * @param loading -- true while placeholders stand in for frames not yet read
+ */
+void SpriteEditorModel::setLoadingFrames(bool loading)
+{
+    if (loadingFrames == loading)
+        return;
+    loadingFrames = loading;
+    emit frameLoadingChanged(loading);
+}
+
+/**
+ * @brief SpriteEditorModel::newFile
+ * Attempts to create a new file. Works on a model that has no frames yet, as well.
+ *
+ * @param newCanvasSize -- the canvas size of the new file.
+ */
+void SpriteEditorModel::newFile(int newCanvasSize)
+{
+    // Stop any file still being opened in the background, without waiting for it.
+    openWatcher->cancel();
+    finishLoading();
+
+    // End the animation.
+    timer->stop();
+    animationRunning = false;
+    animationIndex = 0;
+    animationTick = 0;
+
+    // Drop any selection, floating or not; it belongs to the sprite being replaced.
+    resetSelection();
+
+    // Set the canvas size.
+    canvasSize = newCanvasSize;
+    emit canvasSizeChanged();
+
+    // Remove the old frames.
+    int oldFrameCount = numFrames;
+    for (int i = 0; i < oldFrameCount - 1; i++)
+        deleteCurrentFrame();
+
+    // Set the first frame, adding it if the model had none.
+    QImage firstFrame(canvasSize, canvasSize, QImage::Format_ARGB32);
+    firstFrame.fill(qRgba(0, 0, 0, 0));
+    bool firstFrameAdded = frames.isEmpty();
+    if (firstFrameAdded)
+    {
+        frames.append(firstFrame);
+        numFrames = 1;
+    }
+    else
+    {
+        frames[0] = firstFrame;
+    }
+    frameDurations = {1};
+    playbackTimeline.clear();
+    resetColorCounts();
+    if (firstFrameAdded)
+        emit framesInserted(0, 1);
+    TRACE_SIGNAL("frameUpdated", emit frameUpdated(0));
+    emit frameDurationChanged(0);
+
+    // Reset the recent colors, palette, and tool.
+    resetRecentColors();
+    emit resetColorPalette();
+    setTool(PEN);
+
+    // Update the stored save directory.
+    saveDir = NULL;
+
+    // Clear undo/redo stacks.
+    edits.clear();
+    undoneEdits.clear();
+
+    // Reset the animation preview.
+    emit resetPreview();
+}
+
+/**
+ * @brief SpriteEditorModel::exportSpriteSheet
+ * Exports every frame into a packed texture atlas at the specified directory,
+ * along with a JSON metadata table of the same name.
+ *
+ * @param fileDir -- the file directory at which the atlas PNG is to be saved.
+ * @return true if the atlas and its metadata were written, false otherwise
+ */
+bool SpriteEditorModel::exportSpriteSheet(QString fileDir)
+{
+    if (loadingFrames)
+        return false;
+
+    commitSelection();
+    shareIdenticalFrames();
+    SpriteSheetExporter exporter(frames);
+    return exporter.exportTo(fileDir);
+}
+
+/**
+ * @brief SpriteEditorModel::exportAnimation
+ * Exports the animation as a looping GIF or APNG at the specified directory. Encoding runs
+ * on a worker thread, reporting progress with animationExportProgress and completion with
+ * animationExportFinished. Each frame is shown for its hold, in ticks of the preview's current frame delay.
+ *
+ * @param fileDir -- the file directory at which the animation is to be saved.
+ * @param format -- the animated image format to write
+ * @return true if the export started, false if another animation is still being exported
+ *         or a file's frames are still being read
+ */
+bool SpriteEditorModel::exportAnimation(QString fileDir, AnimationFormat format)
+{
+    if (exportWatcher->isRunning() || loadingFrames)
+        return false;
+
+    commitSelection();
+
+    // Frames are implicitly shared, so this snapshot is cheap. Drawing while the export
+    // runs detaches the edited frame rather than changing the one being encoded.
+    shareIdenticalFrames();
+    QList<QImage> frameSnapshot = frames;
+    QList<int> durations = frameDurations;
+    int tickDelay = frameDelay > 0 ? frameDelay : DEFAULT_FRAME_DELAY;
+
+    exportWatcher->setFuture(QtConcurrent::run([frameSnapshot, durations, tickDelay, fileDir, format](QPromise<bool>& promise)
+    {
+        std::unique_ptr<AnimationEncoder> encoder;
+        if (format == GIF)
+            encoder = std::make_unique<GifEncoder>();
+        else
+            encoder = std::make_unique<ApngEncoder>();
+
+        promise.setProgressRange(0, frameSnapshot.count());
+        if (!encoder->begin(fileDir, frameSnapshot))
+        {
+            promise.addResult(false);
+            return;
+        }
+
+        // Stream the frames through the encoder one at a time, each shown for its hold. A run
+        // of frames sharing one buffer is written once, shown for the length of the whole run.
+        for (int i = 0; i < frameSnapshot.count(); i++)
+        {
+            int runDelay = tickDelay * durations[i];
+            while (i + 1 < frameSnapshot.count() && frameSnapshot[i + 1].cacheKey() == frameSnapshot[i].cacheKey())
+            {
+                runDelay += tickDelay * durations[i + 1];
+                i++;
+            }
+
+            if (!encoder->addFrame(frameSnapshot[i], runDelay))
+            {
+                promise.addResult(false);
+                return;
+            }
+            promise.setProgressValue(i + 1);
+        }
+
+        promise.addResult(encoder->finish());
+    }));
+    return true;
+}
+
+/**
+ * @brief SpriteEditorModel::importImageSequence
+ * Imports a sequence of images as new frames, ordered by file name (so that "frame2"
+ * comes before "frame10"). The images are decoded concurrently, and each is cropped or
+ * padded to the canvas size from its top-left corner.
+ *
+ * @param fileDirs -- the file directories of the images to import
+ * @return the number of frames imported, which is 0 while a file's frames are still being read
+ */
+int SpriteEditorModel::importImageSequence(QStringList fileDirs)
+{
+    if (loadingFrames)
+        return 0;
+
+    QCollator collator;
+    collator.setNumericMode(true);
+    std::sort(fileDirs.begin(), fileDirs.end(), collator);
+
+    int size = canvasSize;
+    QList<QImage> decodedFrames = QtConcurrent::blockingMapped<QList<QImage>>(fileDirs, [size](const QString& fileDir)
+    {
+        QImage image(fileDir);
+        if (image.isNull())
+            return image;
+        return image.convertToFormat(QImage::Format_ARGB32).copy(0, 0, size, size);
+    });
+    decodedFrames.removeIf([](const QImage& frame){return frame.isNull();});
+
+    return appendFrames(decodedFrames);
+}
+
+/**
+ * @brief SpriteEditorModel::importSpriteSheet
+ * Slices a sprite sheet into a grid of square cells, row by row, and imports each cell as
+ * a new frame. Cells are sliced concurrently, and each is cropped or padded to the canvas
+ * size from its top-left corner.
+ *
+ * @param fileDir -- the file directory of the sprite sheet to import
+ * @param cellSize -- the side length of each cell in the sheet, in pixels
+ * @return the number of frames imported, which is 0 while a file's frames are still being read,
+ *         or -1 if the sheet has more than MAX_SPRITE_SHEET_CELLS cells (in which case none are)
+ */
+int SpriteEditorModel::importSpriteSheet(QString fileDir, int cellSize)
+{
+    if (loadingFrames)
+        return 0;
+
+    QImage sheet(fileDir);
+    if (sheet.isNull() || cellSize <= 0)
+        return 0;
+    sheet = sheet.convertToFormat(QImage::Format_ARGB32);
+
+    // Each cell costs a frame, its color counts, and its place in the history, so refuse
+    // sheets that would add more frames than anyone means to before slicing any.
+    int columns = sheet.width() / cellSize;
+    int rows = sheet.height() / cellSize;
+    if (qint64(columns) * rows > MAX_SPRITE_SHEET_CELLS)
+        return -1;
+    QList<int> cells(columns * rows);
+    std::iota(cells.begin(), cells.end(), 0);
+
+    int size = canvasSize;
+    QList<QImage> slicedFrames = QtConcurrent::blockingMapped<QList<QImage>>(cells, [=](int cell)
+    {
+        return sheet.copy((cell % columns) * cellSize, (cell / columns) * cellSize, cellSize, cellSize)
+                    .copy(0, 0, size, size);
+    });
+
+    return appendFrames(slicedFrames);
+}
+
+/**
+ * @brief SpriteEditorModel::saveClicked
+ * Checks if the current file is associated with a file directory.
+ * If it is, save to that directory in the background. If not, prompt the user to choose a save location.
+ */
+void SpriteEditorModel::saveClicked()
+{
+    if (saveDir.isNull())
+        emit noSaveDirectory();
+    else
+        saveFileAsync(saveDir);
+}
+
+
+// ===================================================
+// ===             FRAME MANIPULATION              ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::createNewFrame
+ * Creates a new, blank frame, adds it to the QList of frames, and emits
+ * a signal so that the view can redraw accordingly.
+ */
+void SpriteEditorModel::createNewFrame()
+{
+    // Frames can't be added while a file's frames are still being read in behind them.
+    if (loadingFrames)
+        return;
+
+    // Create a new QImage frame, add it to the QList of existing frames,
+    //  and ensure that it's blank and transparent
+    frames.push_back(QImage(canvasSize, canvasSize, QImage::Format_ARGB32));
+    numFrames++;
+    frames[numFrames - 1].fill(Qt::transparent);
+    frameDurations.append(1);
+    playbackTimeline.clear();
+    frameHistograms.append(ColorHistogram());
+    changeFrameColors(numFrames - 1, ColorHistogram(frames.at(numFrames - 1)));
+
+    // Set the new frame created as the current frame.
+    currentFrameIndex = numFrames - 1;
+
+    // Adding a frame messes with edit indices: adjust them
+    adjustEditsUpFromIndex(currentFrameIndex);
+
+    emit framesInserted(currentFrameIndex, 1);
+    TRACE_SIGNAL("frameUpdated", emit frameUpdated(currentFrameIndex));
+    enforceMemoryBudget();
+}
+
+/**
+ * @brief SpriteEditorModel::appendFrames
+ * Adds the given frames after the last frame in a single batch, and selects the last of them.
+ * The view is notified once for the whole batch, rather than once per frame.
+ *
+ * @param newFrames -- the frames to append, which must match the canvas size
+ * @return the number of frames appended, which is 0 while a file's frames are still being read
+ */
+int SpriteEditorModel::appendFrames(QList<QImage> newFrames)
+{
+    // Frames can't be added while a file's frames are still being read in behind them.
+    if (newFrames.isEmpty() || loadingFrames)
+        return 0;
+
+    int firstNewIndex = numFrames;
+    frames.append(newFrames);
+    numFrames += newFrames.count();
+    frameDurations.append(QList<int>(newFrames.count(), 1));
+    playbackTimeline.clear();
+
+    // Imported animations often repeat frames to hold a pose; keep a single copy of each.
+    shareIdenticalFrames();
+
+    QList<ColorHistogram> newColors = countFrameColors(frames.mid(firstNewIndex));
+    for (int i = 0; i < newColors.count(); i++)
+    {
+        frameHistograms.append(ColorHistogram());
+        changeFrameColors(firstNewIndex + i, newColors[i]);
+    }
+    emit documentPaletteChanged();
+
+    // Frames are only added at the end, so no edit indices shift.
+    currentFrameIndex = numFrames - 1;
+
+    emit framesInserted(firstNewIndex, newFrames.count());
+    TRACE_SIGNAL("setFocusToIndex", emit setFocusToIndex(currentFrameIndex));
+    enforceMemoryBudget();
+    return newFrames.count();
+}
+
+/**
+ * @brief SpriteEditorModel::selectFrame
+ * Changes the current frame to the frame of the given index.
+ *
+ * @param index -- the index of the frame to select
+ */
+void SpriteEditorModel::selectFrame(int index)
+{
+    // A placeholder can't be drawn on, so it can't be selected until its frame is read.
+    if(index < 0 || index >= getLoadedFrameCount())
+        return;
+
+    // Set the current frame to the selected index
+    currentFrameIndex = index;
+
+    // Update displays
+    TRACE_SIGNAL("setFocusToIndex", emit setFocusToIndex(currentFrameIndex));
+}
+
+/**
+ * @brief SpriteEditorModel::deleteCurrentFrame
+ * Deletes the frame that is currently selected.
+ */
+void SpriteEditorModel::deleteCurrentFrame()
+{
+    // Prevent frame deletion if the animation is running
+    if(animationRunning)
+    {
+        emit warnAboutDeletion();
+        return;
+    }
+
+    if (loadingFrames)
+        return;
+
+    // If there is more than one frame, delete the currently selected one -- don't let the user delete the base frame
+    if(numFrames > 1)
+    {
+        commitSelection();
+
+        // Remove the frame from the list
+        int removedFrameIndex = currentFrameIndex;
+        setFrameColors(currentFrameIndex, ColorHistogram());
+        frames.removeAt(currentFrameIndex);
+        frameDurations.removeAt(currentFrameIndex);
+        playbackTimeline.clear();
+        frameHistograms.removeAt(currentFrameIndex);
+        adjustEditsDownFromIndex(currentFrameIndex);
+
+        // Decrement the number of frames, and the current frame index
+        numFrames--;
+
+        // Decrement the frame index ONLY IF we weren't already at 0
+        if(currentFrameIndex > 0)
+            currentFrameIndex--;
+
+        // Update display, once the model is consistent again
+        emit frameRemoved(removedFrameIndex);
+        TRACE_SIGNAL("setFocusToIndex", emit setFocusToIndex(currentFrameIndex));
+        emit documentPaletteChanged();
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::clearCurrentFrame
+ * Fills the currently selected frame with transparent pixels.
+ */
+void SpriteEditorModel::clearCurrentFrame()
+{
+    commitSelection();
+    frames[currentFrameIndex].fill(Qt::transparent);
+    setFrameColors(currentFrameIndex, ColorHistogram(frames.at(currentFrameIndex)));
+
+    TRACE_SIGNAL("frameUpdated", emit frameUpdated(currentFrameIndex));
+    emit documentPaletteChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::duplicateCurrentFrame
+ * Duplicates the currently selected frame.
+ */
+void SpriteEditorModel::duplicateCurrentFrame()
+{
+    if (loadingFrames)
+        return;
+
+    commitSelection();
+
+    // Share the selected frame's pixels; they are only copied once either frame is drawn on.
+    QImage duplicate = frames.at(currentFrameIndex);
+
+    // Add the duplicate to the QList of existing frames. Increment frame counter.
+    frames.push_back(duplicate);
+    numFrames++;
+    frameDurations.append(frameDurations.at(currentFrameIndex));
+    playbackTimeline.clear();
+    frameHistograms.append(ColorHistogram());
+    changeFrameColors(numFrames - 1, frameHistograms.at(currentFrameIndex));
+
+    // Set the new frame created as the current frame.
+    currentFrameIndex = numFrames - 1;
+
+    adjustEditsUpFromIndex(currentFrameIndex);
+
+    emit framesInserted(currentFrameIndex, 1);
+    TRACE_SIGNAL("frameUpdated", emit frameUpdated(currentFrameIndex));
+    enforceMemoryBudget();
+}
+
+// ===================================================
+// ===               FRAME TRANSFORMS              ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::transformFrames
+ * Applies a whole-frame transform to each of the given frames, as a single undoable edit.
+ * Frames are transformed concurrently, and frames sharing one buffer are transformed once.
+ * The edit keeps the frames from before and after the transform, which share their
+ * pixels with the frames, instead of recording every changed pixel.
+ *
+ * @param frameIndices -- the indices of the frames to transform
+ * @param transform -- computes the transformed frame from the original
+ * @param mapColors -- computes the color counts of a transformed frame from those of the original,
+ *                     or is empty if the transformed frames have to be counted
+ */
+void SpriteEditorModel::transformFrames(QList<int> frameIndices, std::function<QImage(const QImage&)> transform,
+                                        std::function<ColorHistogram(const ColorHistogram&)> mapColors)
+{
+    TRACE_SCOPE("transformFrames");
+
+    if (loadingFrames)
+        return;
+
+    commitSelection();
+
+    // Collect each distinct frame buffer once.
+    QHash<qint64, int> distinctByCacheKey;
+    QList<QImage> distinctFrames;
+    QList<int> distinctIndices;
+    for (int frameIndex : frameIndices)
+    {
+        const QImage& frame = frames.at(frameIndex);
+        int distinctIndex = distinctByCacheKey.value(frame.cacheKey(), distinctFrames.count());
+        if (distinctIndex == distinctFrames.count())
+        {
+            distinctByCacheKey.insert(frame.cacheKey(), distinctIndex);
+            distinctFrames.append(frame);
+        }
+        distinctIndices.append(distinctIndex);
+    }
+
+    QList<QImage> transformedFrames = QtConcurrent::blockingMapped<QList<QImage>>(distinctFrames, transform);
+    QList<ColorHistogram> transformedColors;
+    if (!mapColors)
+        transformedColors = countFrameColors(transformedFrames);
+
+    SpriteEdit transformEdit(currentFrameIndex);
+    for (int i = 0; i < frameIndices.count(); i++)
+    {
+        int frameIndex = frameIndices[i];
+        const QImage& transformed = transformedFrames[distinctIndices[i]];
+        if (transformed == frames.at(frameIndex))
+            continue;
+
+        ColorHistogram colorChange = mapColors ? mapColors(frameHistograms.at(frameIndex))
+                                               : transformedColors[distinctIndices[i]];
+        colorChange.subtract(frameHistograms.at(frameIndex));
+
+        transformEdit.addFrameSnapshot(frameIndex, frames.at(frameIndex).rect(), frames.at(frameIndex), transformed, colorChange);
+        frames[frameIndex] = transformed;
+        changeFrameColors(frameIndex, colorChange);
+    }
+
+    if (transformEdit.isEmpty())
+        return;
+
+    undoneEdits.clear();
+    edits.push(transformEdit);
+
+    for (int frameIndex : transformEdit.getFrameIndices())
+        TRACE_SIGNAL("frameUpdated", emit frameUpdated(frameIndex));
+    emit documentPaletteChanged();
+    enforceMemoryBudget();
+}
+
+/**
+ * @brief SpriteEditorModel::flipFrames
+ * Mirrors the given frames left-to-right or top-to-bottom.
+ *
+ * @param frameIndices -- the indices of the frames to flip
+ * @param orientation -- Qt::Horizontal to flip left-to-right, Qt::Vertical to flip top-to-bottom
+ */
+void SpriteEditorModel::flipFrames(QList<int> frameIndices, Qt::Orientation orientation)
+{
+    transformFrames(frameIndices, [orientation](const QImage& frame)
+                    {return FrameTransforms::flipped(frame, orientation);},
+                    [](const ColorHistogram& colors){return colors;});
+}
+
+/**
+ * @brief SpriteEditorModel::rotateFrames
+ * Rotates the given frames a quarter turn.
+ *
+ * @param frameIndices -- the indices of the frames to rotate
+ * @param clockwise -- true to rotate clockwise, false to rotate counterclockwise
+ */
+void SpriteEditorModel::rotateFrames(QList<int> frameIndices, bool clockwise)
+{
+    transformFrames(frameIndices, [clockwise](const QImage& frame)
+                    {return FrameTransforms::rotated(frame, clockwise);},
+                    [](const ColorHistogram& colors){return colors;});
+}
+
+/**
+ * @brief SpriteEditorModel::shiftFrames
+ * Moves the contents of the given frames, wrapping around the edges.
+ *
+ * @param frameIndices -- the indices of the frames to shift
+ * @param dx -- the number of pixels to shift right (negative shifts left)
+ * @param dy -- the number of pixels to shift down (negative shifts up)
+ */
+void SpriteEditorModel::shiftFrames(QList<int> frameIndices, int dx, int dy)
+{
+    transformFrames(frameIndices, [dx, dy](const QImage& frame)
+                    {return FrameTransforms::shifted(frame, dx, dy);},
+                    [](const ColorHistogram& colors){return colors;});
+}
+
+/**
+ * @brief SpriteEditorModel::swapPalette
+ * Replaces colors in the given frames according to a color map. Every pixel of a
+ * replaced color changes, so the new color counts follow from the old ones.
+ *
+ * @param frameIndices -- the indices of the frames to recolor
+ * @param colorMap -- maps each color to replace to its replacement
+ */
+void SpriteEditorModel::swapPalette(QList<int> frameIndices, QHash<QRgb, QRgb> colorMap)
+{
+    transformFrames(frameIndices, [colorMap](const QImage& frame)
+                    {return FrameTransforms::paletteSwapped(frame, colorMap);},
+                    [colorMap](const ColorHistogram& colors){return colors.remapped(colorMap);});
+}
+
+/**
+ * @brief SpriteEditorModel::replaceColors
+ * Replaces colors everywhere they appear in the sprite, as a single undoable edit.
+ *
+ * @param colorMap -- maps each color to replace to its replacement
+ */
+void SpriteEditorModel::replaceColors(QHash<QRgb, QRgb> colorMap)
+{
+    QList<int> frameIndices(numFrames);
+    std::iota(frameIndices.begin(), frameIndices.end(), 0);
+    swapPalette(frameIndices, colorMap);
+}
+
+/**
+ * @brief SpriteEditorModel::reduceColors
+ * Reduces every frame to a palette of at most the given number of colors, as a single
+ * undoable edit. The palette is chosen by a median cut of the document's color counts,
+ * refined with k-means, so no pixel is read to choose it. Frames are then remapped
+ * concurrently. Afterwards, the document palette holds only the colors still in use.
+ *
+ * @param maxColors -- the largest number of visible colors to keep
+ * @param dither -- whether to apply ordered dithering while remapping
+ * @return the palette the frames were reduced to
+ */
+QList<QRgb> SpriteEditorModel::reduceColors(int maxColors, bool dither)
+{
+    TRACE_SCOPE("reduceColors");
+
+    if (loadingFrames)
+        return QList<QRgb>();
+
+    // Transparent pixels stay transparent, so they have no say in the palette.
+    QHash<QRgb, qint64> visibleCounts;
+    const QHash<QRgb, qint64>& documentCounts = documentHistogram.getCounts();
+    for (auto entry = documentCounts.constBegin(); entry != documentCounts.constEnd(); ++entry)
+        if (qAlpha(entry.key()) != 0)
+            visibleCounts.insert(entry.key(), entry.value());
+
+    QList<QRgb> palette = ColorQuantizer::kMeans(visibleCounts, ColorQuantizer::medianCut(visibleCounts, maxColors),
+                                                 COLOR_REDUCTION_ITERATIONS);
+
+    QList<int> frameIndices(numFrames);
+    std::iota(frameIndices.begin(), frameIndices.end(), 0);
+    transformFrames(frameIndices, [palette, dither](const QImage& frame)
+                    {return FrameTransforms::quantized(frame, palette, dither);}, nullptr);
+
+    removeUnusedColors();
+    return palette;
+}
+
+/**
+ * @brief SpriteEditorModel::outlineFrames
+ * Draws a one-pixel outline around the shapes in the given frames.
+ *
+ * @param frameIndices -- the indices of the frames to outline
+ * @param outlineColor -- the color of the outline
+ */
+void SpriteEditorModel::outlineFrames(QList<int> frameIndices, QColor outlineColor)
+{
+    QRgb outlineRgba = outlineColor.rgba();
+    transformFrames(frameIndices, [outlineRgba](const QImage& frame)
+                    {return FrameTransforms::outlined(frame, outlineRgba);}, nullptr);
+}
+
+
+// ===================================================
+// ===                  SELECTION                  ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::hasSelection
+ *
+ * @return whether any pixels are selected
+ */
+bool SpriteEditorModel::hasSelection()
+{
+    return !selectionRect.isEmpty();
+}
+
+/**
+ * @brief SpriteEditorModel::getSelectionRect
+ *
+ * @return the bounds of the selection, in frame pixels, or an empty rect if nothing is selected
+ */
+QRect SpriteEditorModel::getSelectionRect()
+{
+    return selectionRect;
+}
+
+/**
+ * @brief SpriteEditorModel::getFloatingSelection
+ * A floating selection holds pixels that have been lifted out of a frame or pasted, and
+ * are drawn over the current frame at the selection's position until they are committed.
+ * Pixels outside the selected shape are transparent.
+ *
+ * @return the floating pixels, or a null image if the selection isn't floating
+ */
+QImage SpriteEditorModel::getFloatingSelection()
+{
+    return floatingSelection;
+}
+
+/**
+ * @brief SpriteEditorModel::selectRect
+ * Selects a rectangle of the current frame, after committing any floating selection.
+ *
+ * @param rect -- the rectangle to select, which is clipped to the canvas
+ */
+void SpriteEditorModel::selectRect(QRect rect)
+{
+    commitSelection();
+
+    // A null mask means every pixel of the rectangle is selected.
+    selectionRect = rect.intersected(QRect(0, 0, canvasSize, canvasSize));
+    selectionMask = QImage();
+    emit selectionChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::selectAll
+ * Selects the whole of the current frame.
+ */
+void SpriteEditorModel::selectAll()
+{
+    selectRect(QRect(0, 0, canvasSize, canvasSize));
+}
+
+/**
+ * @brief SpriteEditorModel::selectSimilar
+ * Selects the pixels of the current frame connected to the given pixel, horizontally or
+ * vertically, that have exactly its color.
+ *
+ * @param seed -- the pixel to start from
+ */
+void SpriteEditorModel::selectSimilar(QPoint seed)
+{
+    commitSelection();
+
+    const QImage& frame = frames.at(currentFrameIndex);
+    if (!frame.rect().contains(seed))
+        return;
+
+    QRgb seedColor = frame.pixel(seed);
+    QImage mask(frame.size(), QImage::Format_Alpha8);
+    mask.fill(Qt::transparent);
+    QRect bounds(seed, seed);
+
+    // Pixels are marked as they are found, so none is visited twice.
+    QList<QPoint> toVisit{seed};
+    mask.scanLine(seed.y())[seed.x()] = 255;
+    while (!toVisit.isEmpty())
+    {
+        QPoint pixel = toVisit.takeLast();
+        bounds = bounds.united(QRect(pixel, pixel));
+
+        for (QPoint neighbor : {pixel + QPoint(1, 0), pixel - QPoint(1, 0), pixel + QPoint(0, 1), pixel - QPoint(0, 1)})
+        {
+            if (!frame.rect().contains(neighbor) || mask.constScanLine(neighbor.y())[neighbor.x()] != 0)
+                continue;
+            if (reinterpret_cast<const QRgb*>(frame.constScanLine(neighbor.y()))[neighbor.x()] != seedColor)
+                continue;
+
+            mask.scanLine(neighbor.y())[neighbor.x()] = 255;
+            toVisit.append(neighbor);
+        }
+    }
+
+    selectionRect = bounds;
+    selectionMask = mask.copy(bounds);
+    emit selectionChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::clearSelection
+ * Commits any floating selection, then selects nothing.
+ */
+void SpriteEditorModel::clearSelection()
+{
+    commitSelection();
+    resetSelection();
+}
+
+/**
+ * @brief SpriteEditorModel::moveSelection
+ * Moves the selected pixels, lifting them out of the current frame first if they aren't
+ * floating yet. Nothing is written into a frame until the selection is committed, so the
+ * selection can be moved freely, and onto other frames by selecting them while it floats.
+ *
+ * @param topLeft -- the new position of the selection's top-left corner, which may be off the canvas
+ */
+void SpriteEditorModel::moveSelection(QPoint topLeft)
+{
+    if (!hasSelection() || topLeft == selectionRect.topLeft())
+        return;
+
+    if (floatingSelection.isNull())
+        liftSelection();
+    selectionRect.moveTopLeft(topLeft);
+    emit selectionChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::copySelection
+ *
+ * @return the selected pixels, with the pixels outside the selected shape transparent,
+ *         or a null image if nothing is selected
+ */
+QImage SpriteEditorModel::copySelection()
+{
+    if (!hasSelection())
+        return QImage();
+    if (!floatingSelection.isNull())
+        return floatingSelection;
+
+    const QImage& frame = frames.at(currentFrameIndex);
+    QImage copied = selectionRect == frame.rect() ? frame : frame.copy(selectionRect);
+    if (selectionMask.isNull())
+        return copied;
+
+    for (int y = 0; y < copied.height(); y++)
+    {
+        const uchar* maskLine = selectionMask.constScanLine(y);
+        QRgb* copiedLine = reinterpret_cast<QRgb*>(copied.scanLine(y));
+        for (int x = 0; x < copied.width(); x++)
+            if (maskLine[x] == 0)
+                copiedLine[x] = 0;
+    }
+    return copied;
+}
+
+/**
+ * @brief SpriteEditorModel::deleteSelection
+ * Makes the selected pixels transparent, as a single undoable edit. A floating selection
+ * is discarded, leaving the frame it was lifted from without it.
+ */
+void SpriteEditorModel::deleteSelection()
+{
+    if (!hasSelection())
+        return;
+
+    if (floatingSelection.isNull())
+        liftSelection();
+    floatingSelection = QImage(floatingSelection.size(), QImage::Format_ARGB32);
+    floatingSelection.fill(Qt::transparent);
+    commitSelection();
+}
+
+/**
+ * @brief SpriteEditorModel::pasteImage
+ * Commits any floating selection, then floats the given image over the current frame
+ * as a new rectangular selection.
+ *
+ * @param image -- the image to paste
+ * @param topLeft -- the position of the image's top-left corner on the canvas
+ */
+void SpriteEditorModel::pasteImage(QImage image, QPoint topLeft)
+{
+    commitSelection();
+    if (image.isNull())
+        return;
+
+    floatingSelection = image.convertToFormat(QImage::Format_ARGB32);
+    selectionRect = QRect(topLeft, floatingSelection.size());
+    selectionMask = QImage();
+    liftedFrameIndex = -1;
+    emit selectionChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::commitSelection
+ * Writes a floating selection into the current frame, as a single undoable edit. Only its
+ * visible pixels are written, and only those on the canvas. The edit holds a snapshot of
+ * just the region each frame changed in: where the pixels were lifted from, and where they landed.
+ */
+void SpriteEditorModel::commitSelection()
+{
+    if (floatingSelection.isNull())
+        return;
+
+    TRACE_SCOPE("commitSelection");
+
+    // The lifted frame's original was kept when the pixels were lifted. Any other frame is
+    // shared here, so writing into it below copies it and leaves the original intact.
+    int targetIndex = currentFrameIndex;
+    QImage targetOriginal = targetIndex == liftedFrameIndex ? liftedFrameOriginal : frames.at(targetIndex);
+    QRect pasteRect = selectionRect.intersected(frames.at(targetIndex).rect());
+    QPoint offset = pasteRect.topLeft() - selectionRect.topLeft();
+
+    QImage& target = frames[targetIndex];
+    for (int y = 0; y < pasteRect.height(); y++)
+    {
+        const QRgb* floatingLine = reinterpret_cast<const QRgb*>(floatingSelection.constScanLine(offset.y() + y)) + offset.x();
+        QRgb* targetLine = reinterpret_cast<QRgb*>(target.scanLine(pasteRect.y() + y)) + pasteRect.x();
+        for (int x = 0; x < pasteRect.width(); x++)
+            if (qAlpha(floatingLine[x]) != 0)
+                targetLine[x] = floatingLine[x];
+    }
+
+    SpriteEdit selectionEdit(targetIndex);
+    if (liftedFrameIndex == targetIndex)
+    {
+        recordRegionChange(selectionEdit, targetIndex, liftedRect.united(pasteRect), targetOriginal);
+    }
+    else
+    {
+        if (liftedFrameIndex >= 0)
+            recordRegionChange(selectionEdit, liftedFrameIndex, liftedRect, liftedFrameOriginal);
+        recordRegionChange(selectionEdit, targetIndex, pasteRect, targetOriginal);
+    }
+
+    // Whatever landed off the canvas is gone; the pixels that landed stay selected.
+    if (!selectionMask.isNull())
+        selectionMask = selectionMask.copy(pasteRect.translated(-selectionRect.topLeft()));
+    selectionRect = pasteRect;
+    floatingSelection = QImage();
+    liftedFrameOriginal = QImage();
+    liftedFrameIndex = -1;
+    liftedRect = QRect();
+
+    if (!selectionEdit.isEmpty())
+    {
+        undoneEdits.clear();
+        edits.push(selectionEdit);
+    }
+
+    for (int frameIndex : selectionEdit.getFrameIndices())
+        TRACE_SIGNAL("frameUpdated", emit frameUpdated(frameIndex));
+    emit documentPaletteChanged();
+    emit selectionChanged();
+    enforceMemoryBudget();
+}
+
+/**
+ * @brief SpriteEditorModel::liftSelection
+ * Moves the selected pixels of the current frame into a floating selection, leaving them
+ * transparent in the frame. The frame from before the lift is kept, sharing its pixels,
+ * so that the commit can record what changed. The color counts aren't touched until then.
+ */
+void SpriteEditorModel::liftSelection()
+{
+    QImage& frame = frames[currentFrameIndex];
+    liftedFrameIndex = currentFrameIndex;
+    liftedRect = selectionRect;
+    liftedFrameOriginal = frame;
+
+    if (selectionMask.isNull() && selectionRect == frame.rect())
+    {
+        // Lifting the whole frame shares its pixels, and starts the frame over.
+        floatingSelection = frame;
+        frame = QImage(frame.size(), QImage::Format_ARGB32);
+        frame.fill(Qt::transparent);
+    }
+    else
+    {
+        floatingSelection = frame.copy(selectionRect);
+        for (int y = 0; y < selectionRect.height(); y++)
+        {
+            QRgb* floatingLine = reinterpret_cast<QRgb*>(floatingSelection.scanLine(y));
+            QRgb* frameLine = reinterpret_cast<QRgb*>(frame.scanLine(selectionRect.y() + y)) + selectionRect.x();
+            const uchar* maskLine = selectionMask.isNull() ? nullptr : selectionMask.constScanLine(y);
+            for (int x = 0; x < selectionRect.width(); x++)
+            {
+                if (maskLine && maskLine[x] == 0)
+                    floatingLine[x] = 0;
+                else
+                    frameLine[x] = 0;
+            }
+        }
+    }
+
+    TRACE_SIGNAL("frameUpdated", emit frameUpdated(liftedFrameIndex));
+}
+
+/**
+ * @brief SpriteEditorModel::resetSelection
+ * Selects nothing, discarding any floating selection without committing it.
+ */
+void SpriteEditorModel::resetSelection()
+{
+    selectionRect = QRect();
+    selectionMask = QImage();
+    floatingSelection = QImage();
+    liftedFrameOriginal = QImage();
+    liftedFrameIndex = -1;
+    liftedRect = QRect();
+    emit selectionChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::recordRegionChange
+ * Adds a snapshot of a region of a frame to an edit, if the region has changed from the
+ * given original, and updates the color counts by the change.
+ *
+ * @param edit -- the edit to add the snapshot to
+ * @param frameIndex -- the index of the changed frame
+ * @param rect -- the region that may have changed
+ * @param original -- the frame from before the change
+ */
+void SpriteEditorModel::recordRegionChange(SpriteEdit& edit, int frameIndex, QRect rect, const QImage& original)
+{
+    if (rect.isEmpty())
+        return;
+
+    const QImage& frame = frames.at(frameIndex);
+    QImage before = rect == original.rect() ? original : original.copy(rect);
+    QImage after = rect == frame.rect() ? frame : frame.copy(rect);
+    if (before == after)
+        return;
+
+    ColorHistogram colorChange(after);
+    colorChange.subtract(ColorHistogram(before));
+    edit.addFrameSnapshot(frameIndex, rect, before, after, colorChange);
+    changeFrameColors(frameIndex, colorChange);
+}
+
+
+// ===================================================
+// ===                MEMORY BUDGET                ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::setMemoryBudget
+ * Sets how many bytes the document may hold, and enforces it at once.
+ *
+ * @param budget -- the budget in bytes, or 0 for no budget
+ */
+void SpriteEditorModel::setMemoryBudget(qint64 budget)
+{
+    memoryBudget = qMax<qint64>(0, budget);
+    overMemoryBudget = false;
+    enforceMemoryBudget();
+}
+
+/**
+ * @brief SpriteEditorModel::enforceMemoryBudget
+ * If the document holds more than its budget, frees memory in order of how little it is
+ * missed: first duplicate frame buffers, which are shared without changing any pixels;
+ * then every cache, which is rebuilt on demand; then the redo stack, oldest first; and
+ * last the undo stack, oldest first. The frames themselves are never dropped, so if they
+ * alone are over budget, nothing else is dropped either, since it couldn't help. Emits
+ * memoryBudgetExceeded once each time the document goes over budget.
+ */
+void SpriteEditorModel::enforceMemoryBudget()
+{
+    if (memoryBudget <= 0)
+        return;
+
+    MemoryUsage usage = getMemoryUsage();
+    if (usage.totalBytes <= memoryBudget)
+    {
+        overMemoryBudget = false;
+        return;
+    }
+    qint64 bytesBefore = usage.totalBytes;
+
+    shareIdenticalFrames();
+    if (getFramesByteCount() > memoryBudget)
+    {
+        if (!overMemoryBudget)
+            emit memoryBudgetExceeded(bytesBefore, getMemoryUsage().totalBytes, memoryBudget);
+        overMemoryBudget = true;
+        return;
+    }
+
+    frameHashes.clear();
+    for (const CacheReporter& reporter : cacheReporters)
+        if (!reporter.owner.isNull())
+            reporter.evict();
+    usage = getMemoryUsage();
+
+    // An edit's pixels are only freed once no frame or remaining edit shares them.
+    QHash<qint64, int> bufferUsers;
+    for (const QImage& frame : frames)
+        bufferUsers[frame.cacheKey()]++;
+    for (QStack<SpriteEdit>* stack : {&edits, &undoneEdits})
+        for (SpriteEdit& edit : *stack)
+            for (const SpriteEdit::FrameSnapshot& snapshot : edit.getFrameSnapshots())
+            {
+                bufferUsers[snapshot.before.cacheKey()]++;
+                bufferUsers[snapshot.after.cacheKey()]++;
+            }
+
+    auto dropOldestEdit = [&](QStack<SpriteEdit>& stack)
+    {
+        SpriteEdit edit = stack.takeFirst();
+        QSet<qint64> sharedBuffers;
+        for (const SpriteEdit::FrameSnapshot& snapshot : edit.getFrameSnapshots())
+            for (qint64 cacheKey : {snapshot.before.cacheKey(), snapshot.after.cacheKey()})
+                if (--bufferUsers[cacheKey] > 0)
+                    sharedBuffers.insert(cacheKey);
+        usage.totalBytes -= edit.getByteCount(sharedBuffers);
+    };
+
+    // The edit furthest from the current state is the least likely to be reached again.
+    while (usage.totalBytes > memoryBudget && !undoneEdits.isEmpty())
+        dropOldestEdit(undoneEdits);
+    while (usage.totalBytes > memoryBudget && !edits.isEmpty())
+        dropOldestEdit(edits);
+
+    overMemoryBudget = usage.totalBytes > memoryBudget;
+    emit memoryBudgetExceeded(bytesBefore, usage.totalBytes, memoryBudget);
+}
+
+
+// ===================================================
+// ===                PREVIEW FRAME                ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::setFrameDurations
+ * Sets how long each of the given frames is held in the animation.
+ *
+ * @param frameIndices -- the indices of the frames
+ * @param duration -- the number of animation ticks to hold each frame for, at least 1
+ */
+void SpriteEditorModel::setFrameDurations(QList<int> frameIndices, int duration)
+{
+    if (loadingFrames)
+        return;
+
+    duration = qMax(1, duration);
+    for (int frameIndex : frameIndices)
+    {
+        if (frameDurations.at(frameIndex) == duration)
+            continue;
+        frameDurations[frameIndex] = duration;
+        playbackTimeline.clear();
+        emit frameDurationChanged(frameIndex);
+    }
+
+    // Keep the frame on screen, but reschedule the next one for the new timeline.
+    if (animationRunning && frameDelay > 0)
+    {
+        animationTick = getPlaybackTick();
+        playbackClock.restart();
+        animatePreviewFrame();
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::getPlaybackTimeline
+ * The timeline holds the tick at which each frame starts, followed by the length of the
+ * whole animation. It is only rebuilt after frames or their durations change, or more of a
+ * file being opened is read.
+ *
+ * @return the cumulative start tick of each frame, then the total number of ticks
+ */
+const QList<qint64>& SpriteEditorModel::getPlaybackTimeline()
+{
+    if (playbackTimeline.isEmpty())
+    {
+        // Frames still being read are left out, so the preview only shows frames it has.
+        int playableFrames = getLoadedFrameCount();
+        playbackTimeline.reserve(playableFrames + 1);
+        qint64 startTick = 0;
+        playbackTimeline.append(startTick);
+        for (int i = 0; i < playableFrames; i++)
+            playbackTimeline.append(startTick += frameDurations[i]);
+    }
+    return playbackTimeline;
+}
+
+/**
+ * @brief SpriteEditorModel::getPlaybackTick
+ *
+ * @return the tick of the animation that is due now, wrapped to the length of the animation
+ */
+qint64 SpriteEditorModel::getPlaybackTick()
+{
+    qint64 tick = animationTick;
+    if (animationRunning && frameDelay > 0)
+        tick += playbackClock.elapsed() / frameDelay;
+    return tick % getPlaybackTimeline().last();
+}
+
+/**
+ * @brief SpriteEditorModel::toggleAnimation
+ * Toggles the animation state between started
+ * (if the frame delay is more than 0) and stopped.
+ */
+void SpriteEditorModel::toggleAnimation()
+{
+    if(!animationRunning && frameDelay > 0)
+    {
+        animationRunning = true;
+        animationTick = 0;
+        playbackClock.start();
+        animatePreviewFrame();
+        emit animationStarted();
+    }
+    else if (animationRunning)
+    {
+        timer->stop();
+        animationRunning = false;
+        animationTick = 0;
+        animatePreviewFrame();
+        emit animationStopped();
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::changeAnimationSpeed
+ * If the slider value is greater than 0, sets the length of an animation tick to a frames
+ * per second value calculated from the slider value. The animation carries on from the
+ * frame it is on.
+ *
+ * @param FPS -- the value of the slider in the UI
+ */
+void SpriteEditorModel::changeAnimationSpeed(int FPS)
+{
+    if (animationRunning)
+        animationTick = getPlaybackTick();
+
+    // If the slider is set to 0, stop the animation
+    if(FPS <= 0)
+    {
+        frameDelay = 0;
+        timer->stop();
+        return;
+    }
+
+    // Calculate the FPS and set that as the tick length
+    double fpsScaled = 1/(double)FPS;
+    frameDelay = fpsScaled * 1000;
+    if (animationRunning)
+    {
+        playbackClock.restart();
+        animatePreviewFrame();
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::animatePreviewFrame
+ * Displays the frame that is due, found by a binary search of the timeline, and schedules
+ * a single wakeup for when the next frame starts. A held frame costs no more than any
+ * other. While the animation is stopped, each call steps to the next frame instead.
+ */
+void SpriteEditorModel::animatePreviewFrame()
+{
+    const QList<qint64>& timeline = getPlaybackTimeline();
+    qint64 tick = getPlaybackTick();
+    animationIndex = std::upper_bound(timeline.begin(), timeline.end() - 1, tick) - timeline.begin() - 1;
+
+    TRACE_SIGNAL("displayPreviewFrame", emit displayPreviewFrame(&frames[animationIndex]));
+
+    qint64 nextTick = timeline[animationIndex + 1];
+    if (!animationRunning)
+    {
+        animationTick = nextTick % timeline.last();
+        return;
+    }
+    if (frameDelay <= 0)
+        return;
+
+    // Time the wakeup from the clock, not from this call, so that late wakeups don't add up.
+    qint64 loopLength = timeline.last() * frameDelay;
+    qint64 loopTime = (animationTick * frameDelay + playbackClock.elapsed()) % loopLength;
+    timer->start(int(qMax<qint64>(0, nextTick * frameDelay - loopTime)));
+}
+
+// ===================================================
+// ===              EDIT MANIPULATION              ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorModel::undo
+ * "Undoes" a previously-made edit, if there are any to be undone,
+ * and signals to the view to redraw itself if necessary.
+ */
+void SpriteEditorModel::undo()
+{
+    TRACE_SCOPE("undo");
+
+    commitSelection();
+    if (edits.isEmpty())
+        return;
+
+    SpriteEdit editToUndo = edits.pop();
+
+    // For undoing, set each affected pixel to its "old" color, and each affected region to its "before" snapshot
+    for (const auto& [coord, oldColor, newColor] : editToUndo.getComponents())
+    {
+        frames[editToUndo.getFrameIndex()].setPixel(coord, oldColor.rgba());
+        countPixelChange(editToUndo.getFrameIndex(), newColor.rgba(), oldColor.rgba());
+    }
+    for (const SpriteEdit::FrameSnapshot& snapshot : editToUndo.getFrameSnapshots())
+    {
+        restoreRegion(snapshot.frameIndex, snapshot.rect, snapshot.before);
+        ColorHistogram colorChange;
+        colorChange.subtract(snapshot.colorChange);
+        changeFrameColors(snapshot.frameIndex, colorChange);
+    }
+    undoneEdits.push(editToUndo);
+
+    for (int frameIndex : editToUndo.getFrameIndices())
+        TRACE_SIGNAL("frameUpdated", emit frameUpdated(frameIndex));
+    emit documentPaletteChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::redo
+ * "Redoes" a previously-undone edit, if there are any to be redone,
+ * and signals to the view to redraw itself if necessary.
+ */
+void SpriteEditorModel::redo()
+{
+    TRACE_SCOPE("redo");
+
+    commitSelection();
+    if (undoneEdits.isEmpty())
+        return;
+
+    SpriteEdit editToRedo = undoneEdits.pop();
+
+    // For redoing, set each affected pixel to its "new" color, and each affected region to its "after" snapshot
+    for (const auto& [coord, oldColor, newColor] : editToRedo.getComponents())
+    {
+        frames[editToRedo.getFrameIndex()].setPixel(coord, newColor.rgba());
+        countPixelChange(editToRedo.getFrameIndex(), oldColor.rgba(), newColor.rgba());
+    }
+    for (const SpriteEdit::FrameSnapshot& snapshot : editToRedo.getFrameSnapshots())
+    {
+        restoreRegion(snapshot.frameIndex, snapshot.rect, snapshot.after);
+        changeFrameColors(snapshot.frameIndex, snapshot.colorChange);
+    }
+    edits.push(editToRedo);
+
+    for (int frameIndex : editToRedo.getFrameIndices())
+        TRACE_SIGNAL("frameUpdated", emit frameUpdated(frameIndex));
+    emit documentPaletteChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::beginEdit
+ * Begins the process of "recording" a new edit made on the canvas. The edit may also paint
+ * other frames along with the current one; the whole edit is then undone in a single step.
+ *
+ * @param frameIndices -- the indices of other frames the edit paints the same pixels on
+ */
+void SpriteEditorModel::beginEdit(QList<int> frameIndices)
+{
+    commitSelection();
+    undoneEdits.clear();
+    currentEdit = SpriteEdit(currentFrameIndex);
+
+    // Keep each frame from before the edit, sharing its pixels until it is painted on.
+    editFrameIndices = QList<int>{currentFrameIndex};
+    editFrameOriginals = QList<QImage>{frames.at(currentFrameIndex)};
+    editFrameRect = QRect();
+    for (int frameIndex : frameIndices)
+    {
+        if (frameIndex < 0 || frameIndex >= getLoadedFrameCount() || editFrameIndices.contains(frameIndex))
+            continue;
+        editFrameIndices.append(frameIndex);
+        editFrameOriginals.append(frames.at(frameIndex));
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::getEditFrameIndices
+ *
+ * @return the indices of the frames the current edit paints on, the current frame first
+ */
+QList<int> SpriteEditorModel::getEditFrameIndices()
+{
+    return editFrameIndices;
+}
+
+/**
+ * @brief SpriteEditorModel::addToEdit
+ * Adds a "component" (a changed pixel) to the edit that's currently being tracked,
+ * and moves the pixel from the old color's count to the new color's.
+ *
+ * @param editLocation -- the location of the changed pixel
+ * @param oldColor -- the old color of the changed pixel
+ * @param newColor -- the new color of the changed pixel
+ */
+void SpriteEditorModel::addToEdit(QPoint editLocation, QColor oldColor, QColor newColor)
+{
+    currentEdit.addEditComponent(editLocation, oldColor, newColor);
+    countPixelChange(currentEdit.getFrameIndex(), oldColor.rgba(), newColor.rgba());
+}
+
+/**
+ * @brief SpriteEditorModel::replaceEditFrame
+ * Replaces one of the frames the current edit paints with the painted frame, as a whole.
+ * Rather than each pixel, the edit records the region painted on its frames once it ends.
+ *
+ * @param frameIndex -- the index of the frame to replace, which the edit was begun with
+ * @param frame -- the painted frame
+ * @param changedRect -- the region of the frame that may have been painted
+ */
+void SpriteEditorModel::replaceEditFrame(int frameIndex, QImage frame, QRect changedRect)
+{
+    frames[frameIndex] = frame;
+    editFrameRect |= changedRect;
+}
+
+/**
+ * @brief SpriteEditorModel::endEdit
+ * Finishes the edit by pushing the completed edit to the "edits" stack. The frames the edit
+ * painted are added to it as snapshots of the painted region, which also count their colors.
+ */
+void SpriteEditorModel::endEdit()
+{
+    for (int i = 0; i < editFrameIndices.count(); i++)
+        recordRegionChange(currentEdit, editFrameIndices[i], editFrameRect, editFrameOriginals[i]);
+    editFrameIndices.clear();
+    editFrameOriginals.clear();
+    editFrameRect = QRect();
+
+    if (!currentEdit.isEmpty())
+        edits.push(currentEdit);
+    emit documentPaletteChanged();
+    enforceMemoryBudget();
+}
+
+/**
+ * @brief SpriteEditorModel::adjustEditsUpFromIndex
+ * Adjusts the edits in the edit stacks when a frame has been added, based
+ * on which index the new frame was added at.
+ *
+ * @param addedFrameIndex -- the index at which the new frame was added
+ */
+void SpriteEditorModel::adjustEditsUpFromIndex(int addedFrameIndex)
+{
+    for (SpriteEdit& edit : edits)
+        edit.frameInserted(addedFrameIndex);
+
+    for (SpriteEdit& edit : undoneEdits)
+        edit.frameInserted(addedFrameIndex);
+}
+
+/**
+ * @brief SpriteEditorModel::adjustEditsDownFromIndex
+ * Adjusts the edits in the edit stacks when a frame has been removed, including
+ * removing edits pertaining to the removed frame, based on which index the
+ * frame was deleted from.
+ *
+ * @param removedFrameIndex -- the index from which the removed frame was deleted
+ */
+void SpriteEditorModel::adjustEditsDownFromIndex(int removedFrameIndex)
+{
+    // Walk backwards, so that removing an edit doesn't skip the one after it.
+    // Edits spanning several frames only lose their part on the removed frame.
+    for (int i = edits.size() - 1; i >= 0; i--)
+    {
+        edits[i].frameRemoved(removedFrameIndex);
+        if (edits[i].isEmpty())
+            edits.removeAt(i);
+    }
+
+    for (int i = undoneEdits.size() - 1; i >= 0; i--)
+    {
+        undoneEdits[i].frameRemoved(removedFrameIndex);
+        if (undoneEdits[i].isEmpty())
+            undoneEdits.removeAt(i);
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::clearEditsOnCurrentFrame
+ * Removes all edits associated with the current frame.
+ */
+void SpriteEditorModel::clearEditsOnCurrentFrame()
+{
+    for (int i = edits.size() - 1; i >= 0; i--)
+    {
+        edits[i].discardFrame(currentFrameIndex);
+        if (edits[i].isEmpty())
+            edits.removeAt(i);
+    }
+
+    for (int i = undoneEdits.size() - 1; i >= 0; i--)
+    {
+        undoneEdits[i].discardFrame(currentFrameIndex);
+        if (undoneEdits[i].isEmpty())
+            undoneEdits.removeAt(i);
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::restoreRegion
+ * Writes a snapshot of a region back into a frame. A snapshot of a whole frame simply
+ * becomes the frame again, sharing its pixels rather than copying them.
+ *
+ * @param frameIndex -- the index of the frame to write into
+ * @param rect -- the region the snapshot covers
+ * @param region -- the snapshot, the same size as the region
+ */
+void SpriteEditorModel::restoreRegion(int frameIndex, QRect rect, const QImage& region)
+{
+    QImage& frame = frames[frameIndex];
+    if (rect == frame.rect())
+    {
+        frame = region;
+        return;
+    }
+
+    size_t rowBytes = rect.width() * sizeof(QRgb);
+    for (int y = 0; y < rect.height(); y++)
+        std::memcpy(frame.scanLine(rect.y() + y) + rect.x() * sizeof(QRgb), region.constScanLine(y), rowBytes);
+}
+
+
+// ===================================================
+// ===             COLORS AND TOOLS                ===
+// ===================================================
+
+
+/**
+ * @brief SpriteEditorModel::resetRecentColors
+ * Replaces the recent colors with the default brush color (black), so that there is always
+ * a color for the pen, even when no view is listening to set one.
+ */
+void SpriteEditorModel::resetRecentColors()
+{
+    QColor color;
+    color.setHsv(359, 3, 4);
+    recentColors = {color};
+}
+
+/**
+ * @brief SpriteEditorModel::updateRecentColorsList
+ * Updates the colors in the recent colors list, with a maximum
+ * of five colors total.
+ *
+ * @param color -- the new color to add to the recent colors.
+ */
+void SpriteEditorModel::updateRecentColorsList(QColor color)
+{
+    // If a similar color is already in the recent colors list, then that color is
+    // removed and added to the front of the colors list.
+    for(QColor recentColor: recentColors)
+    {
+        if(areSimilarColors(recentColor, color))
+        {
+            recentColors.remove(recentColors.indexOf(recentColor));
+            break;
+        }
+    }
+
+    // The least recently used color is removed if the recent colors list is full.
+    if(recentColors.count() == 5)
+        recentColors.removeFirst();
+
+    // The new color is added to the recent colors list, and to the document palette.
+    recentColors.append(color);
+    currentColor = color;
+    emit updateRecentColors(recentColors);
+
+    addToDocumentPalette(color.rgba());
+    emit documentPaletteChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::areSimilarColors
+ * Determines if the given two colors are similar. That is, they
+ * differ by less than 3 in saturation or valu, and they have the same hue.
+ *
+ * @param colorOne -- first color to compare for similarity
+ * @param colorTwo -- second color to compare for similarity
+ * @return true if the colors are similar, false otherwise.
+ */
+bool SpriteEditorModel::areSimilarColors(QColor colorOne, QColor colorTwo)
+{
+    return abs(colorOne.value() - colorTwo.value()) < 3
+        && abs(colorOne.saturation() - colorTwo.saturation()) < 3
+        && colorOne.hue() == colorTwo.hue();
+}
+
+/**
+ * @brief SpriteEditorModel::removeUnusedColors
+ * Removes the colors that no pixel has from the document palette.
+ */
+void SpriteEditorModel::removeUnusedColors()
+{
+    documentPalette.removeIf([this](QRgb color){return documentHistogram.getCount(color) == 0;});
+    documentPaletteColors = QSet<QRgb>(documentPalette.begin(), documentPalette.end());
+    emit documentPaletteChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::countFrameColors
+ * Counts the colors of many frames concurrently. Frames sharing one buffer are counted once.
+ *
+ * @param framesToCount -- the frames to count
+ * @return the color counts of each frame, in the same order
+ */
+QList<ColorHistogram> SpriteEditorModel::countFrameColors(QList<QImage> framesToCount)
+{
+    QHash<qint64, int> distinctByCacheKey;
+    QList<QImage> distinctFrames;
+    QList<int> distinctIndices;
+    for (const QImage& frame : framesToCount)
+    {
+        int distinctIndex = distinctByCacheKey.value(frame.cacheKey(), distinctFrames.count());
+        if (distinctIndex == distinctFrames.count())
+        {
+            distinctByCacheKey.insert(frame.cacheKey(), distinctIndex);
+            distinctFrames.append(frame);
+        }
+        distinctIndices.append(distinctIndex);
+    }
+
+    QList<ColorHistogram> distinctColors = QtConcurrent::blockingMapped<QList<ColorHistogram>>(
+                distinctFrames, [](const QImage& frame){return ColorHistogram(frame);});
+
+    QList<ColorHistogram> frameColors;
+    for (int distinctIndex : distinctIndices)
+        frameColors.append(distinctColors[distinctIndex]);
+    return frameColors;
+}
+
+/**
+ * @brief SpriteEditorModel::resetColorCounts
+ * Counts the colors of every frame from scratch, and starts the document palette over
+ * with the colors in use, the most common first. Only needed when a whole sprite is loaded,
+ * or after frames were drawn on directly through getFrame, which bypasses the counts; every
+ * edit made through the model updates the counts by what it changes.
+ */
+void SpriteEditorModel::resetColorCounts()
+{
+    TRACE_SCOPE("resetColorCounts");
+
+    frameHistograms = countFrameColors(frames);
+    documentHistogram = ColorHistogram();
+    for (const ColorHistogram& frameColors : frameHistograms)
+        documentHistogram.add(frameColors);
+
+    documentPalette.clear();
+    documentPaletteColors.clear();
+    for (QRgb color : documentHistogram.getColors())
+        addToDocumentPalette(color);
+    emit documentPaletteChanged();
+}
+
+/**
+ * @brief SpriteEditorModel::setFrameColors
+ * Replaces the color counts of a frame, keeping the document's counts in step.
+ *
+ * @param frameIndex -- the index of the frame
+ * @param colors -- the frame's new color counts
+ */
+void SpriteEditorModel::setFrameColors(int frameIndex, ColorHistogram colors)
+{
+    colors.subtract(frameHistograms.at(frameIndex));
+    changeFrameColors(frameIndex, colors);
+}
+
+/**
+ * @brief SpriteEditorModel::changeFrameColors
+ * Changes the color counts of a frame, and of the document, by the counts of an edit.
+ * Colors that appear for the first time join the document palette.
+ *
+ * @param frameIndex -- the index of the frame
+ * @param colorChange -- the change to each color's count
+ */
+void SpriteEditorModel::changeFrameColors(int frameIndex, const ColorHistogram& colorChange)
+{
+    frameHistograms[frameIndex].add(colorChange);
+
+    const QHash<QRgb, qint64>& changedCounts = colorChange.getCounts();
+    for (auto entry = changedCounts.constBegin(); entry != changedCounts.constEnd(); ++entry)
+    {
+        if (entry.value() > 0 && documentHistogram.getCount(entry.key()) == 0)
+            addToDocumentPalette(entry.key());
+        documentHistogram.add(entry.key(), entry.value());
+    }
+}
+
+/**
+ * @brief SpriteEditorModel::countPixelChange
+ * Moves one pixel of a frame from one color's count to another's.
+ *
+ * @param frameIndex -- the index of the frame
+ * @param oldColor -- the color the pixel had
+ * @param newColor -- the color the pixel has now
+ */
+void SpriteEditorModel::countPixelChange(int frameIndex, QRgb oldColor, QRgb newColor)
+{
+    ColorHistogram& frameColors = frameHistograms[frameIndex];
+    frameColors.add(oldColor, -1);
+    frameColors.add(newColor, 1);
+
+    if (documentHistogram.getCount(newColor) == 0)
+        addToDocumentPalette(newColor);
+    documentHistogram.add(oldColor, -1);
+    documentHistogram.add(newColor, 1);
+}
+
+/**
+ * @brief SpriteEditorModel::addToDocumentPalette
+ * Adds a color to the end of the document palette, unless it is already there or is fully transparent.
+ *
+ * @param color -- the color to add
+ */
+void SpriteEditorModel::addToDocumentPalette(QRgb color)
+{
+    if (qAlpha(color) == 0 || documentPaletteColors.contains(color))
+        return;
+
+    documentPalette.append(color);
+    documentPaletteColors.insert(color);
+}
+
+/**
+ * @brief SpriteEditorModel::setTool
+ * Sets the current tool and color (transparent if eraser). The selection tools
+ * leave the color as it is.
+ *
+ * @param currTool -- the Tool that the model has set as active
+ */
+void SpriteEditorModel::setTool(Tool currTool)
+{
+    currentTool = currTool;
+    switch(currTool)
+    {
+        case PEN:
+            setCurrentColor(recentColors.last());
+            break;
+        case ERASER:
+            setCurrentColor(Qt::transparent);
+            break;
+        case RECTANGLE_SELECT:
+        case MAGIC_WAND:
+            break;
+    }
+}
@@ -0,0 +1,281 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   April 5, 2023
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the class definition for the SpriteEditorModel class.
+ */
+
+
+#ifndef SPRITEEDITORMODEL_H
+#define SPRITEEDITORMODEL_H
+
+#include "colorhistogram.h"
+#include "spriteedit.h"
+#include <QColor>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QImage>
+#include <QMap>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QStack>
+#include <QTimer>
+#include <functional>
+
+/**
+ * @brief The SpriteEditorModel class.
+ * This class stores "state" data for an instance of the Sprite Editor program.
+ */
+class SpriteEditorModel : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SpriteEditorModel(QObject *parent = nullptr);
+
+    enum Tool { PEN, ERASER, RECTANGLE_SELECT, MAGIC_WAND };
+    enum AnimationFormat { GIF, APNG };
+
+    // Every cell of a sprite sheet becomes a frame, so a sheet may only have so many.
+    static const int MAX_SPRITE_SHEET_CELLS = 4096;
+
+    /**
+     * The approximate number of bytes held by the frames, by the undo/redo stacks, and by
+     * each cache, keyed by the name the cache was reported under.
+     */
+    struct MemoryUsage
+    {
+        qint64 frameBytes;
+        qint64 historyBytes;
+        QMap<QString, qint64> cacheBytes;
+        qint64 totalBytes;
+    };
+
+    int getCanvasSize();
+    QColor getCurrentColor();
+    int getCurrentFrameIndex();
+    QImage* getFrame(int);
+    int getFrameCount();
+    int getLoadedFrameCount();
+    bool isLoadingFrames();
+    size_t getFrameHash(int);
+    int getFrameDuration(int);
+    qint64 getFramesByteCount();
+    qint64 getHistoryByteCount();
+    MemoryUsage getMemoryUsage();
+    qint64 getMemoryBudget();
+    void addCacheReporter(QObject*, QString, std::function<qint64()>, std::function<void()>);
+    ColorHistogram getDocumentColors();
+    ColorHistogram getFrameColors(int);
+    QList<QRgb> getDocumentPalette();
+    Tool getTool();
+
+    void saveFile(QString);
+    void openFile(QString);
+    bool saveFileAsync(QString);
+    bool openFileAsync(QString);
+    bool isFileOperationRunning();
+    void newFile(int);
+    bool exportSpriteSheet(QString);
+    bool exportAnimation(QString, SpriteEditorModel::AnimationFormat);
+    int importImageSequence(QStringList);
+    int importSpriteSheet(QString, int);
+
+    void createNewFrame();
+    int appendFrames(QList<QImage>);
+
+    void flipFrames(QList<int>, Qt::Orientation);
+    void rotateFrames(QList<int>, bool);
+    void shiftFrames(QList<int>, int, int);
+    void swapPalette(QList<int>, QHash<QRgb, QRgb>);
+    void replaceColors(QHash<QRgb, QRgb>);
+    QList<QRgb> reduceColors(int, bool);
+    void outlineFrames(QList<int>, QColor);
+    void setFrameDurations(QList<int>, int);
+    void resetColorCounts();
+
+    bool hasSelection();
+    QRect getSelectionRect();
+    QImage getFloatingSelection();
+    void selectRect(QRect);
+    void selectSimilar(QPoint);
+    void moveSelection(QPoint);
+    QImage copySelection();
+    void pasteImage(QImage, QPoint);
+
+    void beginEdit(QList<int> = QList<int>());
+    QList<int> getEditFrameIndices();
+    void addToEdit(QPoint, QColor, QColor);
+    void replaceEditFrame(int, QImage, QRect);
+    void endEdit();
+    void clearEditsOnCurrentFrame();
+
+private:
+    QColor currentColor;
+    Tool currentTool = PEN;
+    QList<QColor> recentColors;
+    void resetRecentColors();
+    int canvasSize = 16;
+    int numFrames;
+    int currentFrameIndex;
+    QList<QImage> frames;
+    QList<int> frameDurations;
+    QHash<qint64, size_t> frameHashes;
+    QList<int> shareIdenticalFrames();
+
+    QList<ColorHistogram> frameHistograms;
+    ColorHistogram documentHistogram;
+    QList<QRgb> documentPalette;
+    QSet<QRgb> documentPaletteColors;
+    QList<ColorHistogram> countFrameColors(QList<QImage>);
+    void setFrameColors(int, ColorHistogram);
+    void changeFrameColors(int, const ColorHistogram&);
+    void countPixelChange(int, QRgb, QRgb);
+    void addToDocumentPalette(QRgb);
+
+    QString saveDir;
+
+    /**
+     * A sprite read from a file, or the frames of one handed over ahead of the rest. A
+     * complete document starts at frame 0 and holds every frame; otherwise, the frame
+     * count is the number of frames in the file, or 0 if that isn't known yet.
+     */
+    struct LoadedDocument
+    {
+        int canvasSize = 0;
+        int frameCount = 0;
+        int firstFrame = 0;
+        QList<QImage> frames;
+        QList<int> durations;
+        bool complete = false;
+    };
+    static bool writeDocument(QString, int, const QList<QImage>&, const QList<int>&, const QList<int>&,
+                              std::function<bool(qint64, qint64)>);
+    static bool readDocument(QString, LoadedDocument&, std::function<bool(qint64, qint64)>,
+                             std::function<void(int, int, const QList<QImage>&)>);
+    void installDocument(QString, const LoadedDocument&);
+    QFutureWatcher<bool>* saveWatcher;
+    QFutureWatcher<LoadedDocument>* openWatcher;
+    QString fileOperationDir;
+
+    bool loadingFrames = false;
+    int loadedFrameCount = 0;
+    int receivedLoadResults = 0;
+    bool documentLoaded = false;
+    void receiveLoadedFrames(int);
+    void placeLoadedFrames(int, QList<QImage>);
+    void finishLoading();
+    void setLoadingFrames(bool);
+
+    QTimer *timer;
+    int animationIndex = 0;
+    bool animationRunning;
+    int frameDelay = 0;
+    qint64 animationTick = 0;
+    QElapsedTimer playbackClock;
+    QList<qint64> playbackTimeline;
+    const QList<qint64>& getPlaybackTimeline();
+    qint64 getPlaybackTick();
+
+    /**
+     * A cache kept outside the model, which the model can measure and empty. The cache
+     * stops being reported once its owner is destroyed.
+     */
+    struct CacheReporter
+    {
+        QPointer<QObject> owner;
+        QString name;
+        std::function<qint64()> byteCount;
+        std::function<void()> evict;
+    };
+    QList<CacheReporter> cacheReporters;
+    qint64 memoryBudget = 0;
+    bool overMemoryBudget = false;
+
+    const int DEFAULT_FRAME_DELAY = 100;
+    const int COLOR_REDUCTION_ITERATIONS = 8;
+    QFutureWatcher<bool>* exportWatcher;
+
+    SpriteEdit currentEdit;
+    QList<int> editFrameIndices;
+    QList<QImage> editFrameOriginals;
+    QRect editFrameRect;
+    QStack<SpriteEdit> edits;
+    QStack<SpriteEdit> undoneEdits;
+    void adjustEditsUpFromIndex(int);
+    void adjustEditsDownFromIndex(int);
+    void restoreRegion(int, QRect, const QImage&);
+    void transformFrames(QList<int>, std::function<QImage(const QImage&)>,
+                         std::function<ColorHistogram(const ColorHistogram&)>);
+
+    QRect selectionRect;
+    QImage selectionMask;
+    QImage floatingSelection;
+    int liftedFrameIndex = -1;
+    QRect liftedRect;
+    QImage liftedFrameOriginal;
+    void liftSelection();
+    void resetSelection();
+    void recordRegionChange(SpriteEdit&, int, QRect, const QImage&);
+
+    void setCanvasSize(int);
+    bool areSimilarColors(QColor, QColor);
+
+public slots:
+    void saveClicked();
+    void cancelFileOperation();
+    void deleteCurrentFrame();
+    void clearCurrentFrame();
+    void selectAll();
+    void clearSelection();
+    void deleteSelection();
+    void commitSelection();
+    void duplicateCurrentFrame();
+    void selectFrame(int);
+    void undo();
+    void redo();
+    void animatePreviewFrame();
+    void toggleAnimation();
+    void changeAnimationSpeed(int);
+    void setCurrentColor(QColor);
+    void updateRecentColorsList(QColor);
+    void removeUnusedColors();
+    void setTool(SpriteEditorModel::Tool);
+    void setMemoryBudget(qint64);
+    void enforceMemoryBudget();
+
+signals:
+    void noSaveDirectory();
+    void fileOperationStarted(QString, bool);
+    void fileOperationProgress(int);
+    void fileOperationFinished(bool);
+    void frameLoadingChanged(bool);
+    void canvasSizeChanged();
+    void setUpNewFrame();
+    void frameUpdated(int);
+    void frameDurationChanged(int);
+    void setFocusToIndex(int);
+    void frameRemoved(int);
+    void framesInserted(int, int);
+    void displayPreviewFrame(QImage*);
+    void resetPreview();
+    void animationStarted();
+    void animationStopped();
+    void animationExportProgress(int, int);
+    void animationExportFinished(bool);
+    void warnAboutDeletion();
+    void updateRecentColors(QList<QColor>);
+    void resetColorPalette();
+    void documentPaletteChanged();
+    void selectionChanged();
+    void memoryBudgetExceeded(qint64, qint64, qint64);
+};
+
+#endif // SPRITEEDITORMODEL_H
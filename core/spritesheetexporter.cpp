@@ -0,0 +1,441 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the implementation of the class definition located in spritesheetexporter.h.
+ */
+
+
+#include "spritesheetexporter.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QtConcurrent>
+#include <algorithm>
+#include <climits>
+
+
+/**
+ * @brief The MaxRectsBin class
+ * A single bin of the MaxRects packing algorithm. The bin tracks the maximal free
+ * rectangles left over after each placement, and places new rectangles using the
+ * "best short side fit" heuristic.
+ */
+class MaxRectsBin
+{
+public:
+    MaxRectsBin(int width, int height)
+        : freeRects{QRect(0, 0, width, height)}
+    {
+
+    }
+
+    QRect insert(QSize size);
+
+private:
+    QList<QRect> freeRects;
+    void splitFreeRects(const QRect&);
+};
+
+/**
+ * @brief MaxRectsBin::insert
+ * Places a rectangle of the given size in the free rectangle that leaves the
+ * smallest leftover on its shorter side.
+ *
+ * @param size -- the size of the rectangle to place
+ * @return the placed rectangle, or a null QRect if it does not fit
+ */
+QRect MaxRectsBin::insert(QSize size)
+{
+    QRect bestRect;
+    int bestShortSide = INT_MAX;
+    int bestLongSide = INT_MAX;
+
+    for (const QRect& freeRect : freeRects)
+    {
+        if (freeRect.width() < size.width() || freeRect.height() < size.height())
+            continue;
+
+        int leftoverX = freeRect.width() - size.width();
+        int leftoverY = freeRect.height() - size.height();
+        int shortSide = qMin(leftoverX, leftoverY);
+        int longSide = qMax(leftoverX, leftoverY);
+
+        if (shortSide < bestShortSide || (shortSide == bestShortSide && longSide < bestLongSide))
+        {
+            bestRect = QRect(freeRect.topLeft(), size);
+            bestShortSide = shortSide;
+            bestLongSide = longSide;
+        }
+    }
+
+    if (!bestRect.isNull())
+        splitFreeRects(bestRect);
+
+    return bestRect;
+}
+
+/**
+ * @brief MaxRectsBin::splitFreeRects
+ * Splits every free rectangle overlapping the newly-used rectangle into the (up to four)
+ * maximal rectangles around it, then drops free rectangles contained in another one.
+ *
+ * @param used -- the rectangle that was just placed
+ */
+void MaxRectsBin::splitFreeRects(const QRect& used)
+{
+    QList<QRect> splitRects;
+    for (const QRect& freeRect : freeRects)
+    {
+        if (!freeRect.intersects(used))
+        {
+            splitRects.append(freeRect);
+            continue;
+        }
+
+        int freeRight = freeRect.x() + freeRect.width();
+        int freeBottom = freeRect.y() + freeRect.height();
+        int usedRight = used.x() + used.width();
+        int usedBottom = used.y() + used.height();
+
+        if (used.x() > freeRect.x())
+            splitRects.append(QRect(freeRect.x(), freeRect.y(), used.x() - freeRect.x(), freeRect.height()));
+        if (usedRight < freeRight)
+            splitRects.append(QRect(usedRight, freeRect.y(), freeRight - usedRight, freeRect.height()));
+        if (used.y() > freeRect.y())
+            splitRects.append(QRect(freeRect.x(), freeRect.y(), freeRect.width(), used.y() - freeRect.y()));
+        if (usedBottom < freeBottom)
+            splitRects.append(QRect(freeRect.x(), usedBottom, freeRect.width(), freeBottom - usedBottom));
+    }
+
+    // Keep only the maximal free rectangles (and one copy of any duplicates).
+    freeRects.clear();
+    for (int i = 0; i < splitRects.count(); i++)
+    {
+        bool isContained = false;
+        for (int j = 0; j < splitRects.count() && !isContained; j++)
+            if (i != j && splitRects[j].contains(splitRects[i]) && (splitRects[j] != splitRects[i] || j < i))
+                isContained = true;
+
+        if (!isContained)
+            freeRects.append(splitRects[i]);
+    }
+}
+
+
+/**
+ * @brief SpriteSheetExporter::SpriteSheetExporter
+ * Constructor. Creates a new exporter for the given frames.
+ *
+ * @param frames -- the frames to pack into the atlas, in animation order
+ */
+SpriteSheetExporter::SpriteSheetExporter(QList<QImage> frames)
+{
+    // Frames are read scanline by scanline, so make sure they are all 32-bit ARGB.
+    // Frames which already are stay shallow copies.
+    for (const QImage& frame : frames)
+        this->frames.append(frame.convertToFormat(QImage::Format_ARGB32));
+}
+
+/**
+ * @brief SpriteSheetExporter::exportTo
+ * Trims, deduplicates, and packs the frames, then writes the atlas image to the given
+ * path and the metadata table to a .json file of the same name.
+ *
+ * @param fileDir -- the path of the atlas PNG to write
+ * @return true if both files were written, false otherwise
+ */
+bool SpriteSheetExporter::exportTo(QString fileDir)
+{
+    // Frames sharing one buffer have the same pixels, so only the first of them is trimmed.
+    QHash<qint64, int> distinctByCacheKey;
+    QList<QImage> distinctFrames;
+    QList<int> distinctIndices;
+    for (const QImage& frame : frames)
+    {
+        int distinctIndex = distinctByCacheKey.value(frame.cacheKey(), distinctFrames.count());
+        if (distinctIndex == distinctFrames.count())
+        {
+            distinctByCacheKey.insert(frame.cacheKey(), distinctIndex);
+            distinctFrames.append(frame);
+        }
+        distinctIndices.append(distinctIndex);
+    }
+
+    // Trimming and hashing are independent per frame, so spread them across all cores.
+    QList<TrimmedFrame> distinctTrimmed = QtConcurrent::blockingMapped<QList<TrimmedFrame>>(
+                distinctFrames, &SpriteSheetExporter::trimFrame);
+    trimmedFrames.clear();
+    for (int distinctIndex : distinctIndices)
+        trimmedFrames.append(distinctTrimmed[distinctIndex]);
+
+    deduplicateFrames();
+    if (!packFrames())
+        return false;
+
+    if (!composeAtlas().save(fileDir, "PNG"))
+        return false;
+
+    QFileInfo atlasInfo(fileDir);
+    QString metadataDir = atlasInfo.path() + "/" + atlasInfo.completeBaseName() + ".json";
+    return writeMetadata(atlasInfo.fileName(), metadataDir);
+}
+
+/**
+ * @brief SpriteSheetExporter::trimFrame
+ * Finds the bounds of the opaque pixels of a frame and hashes the pixels within them.
+ * A fully transparent frame produces an empty trim rectangle.
+ *
+ * @param frame -- the frame to trim
+ * @return the trim rectangle and content hash of the frame
+ */
+SpriteSheetExporter::TrimmedFrame SpriteSheetExporter::trimFrame(const QImage& frame)
+{
+    TrimmedFrame trimmed;
+    int left = frame.width();
+    int right = -1;
+    int top = frame.height();
+    int bottom = -1;
+
+    for (int y = 0; y < frame.height(); y++)
+    {
+        const QRgb* row = reinterpret_cast<const QRgb*>(frame.constScanLine(y));
+        for (int x = 0; x < frame.width(); x++)
+        {
+            if (qAlpha(row[x]) == 0)
+                continue;
+
+            left = qMin(left, x);
+            right = qMax(right, x);
+            top = qMin(top, y);
+            bottom = y;
+        }
+    }
+
+    if (right < 0)
+        return trimmed;
+
+    trimmed.trimRect = QRect(QPoint(left, top), QPoint(right, bottom));
+
+    // Hash the trimmed size along with its pixels, so that equal pixel runs of different shapes differ.
+    size_t hash = qHashMulti(0, trimmed.trimRect.width(), trimmed.trimRect.height());
+    for (int y = top; y <= bottom; y++)
+        hash = qHashBits(frame.constScanLine(y) + left * sizeof(QRgb),
+                         trimmed.trimRect.width() * sizeof(QRgb), hash);
+    trimmed.hash = hash;
+
+    return trimmed;
+}
+
+/**
+ * @brief SpriteSheetExporter::haveSameContent
+ * Compares the trimmed pixels of two frames.
+ *
+ * @param first -- the index of the first frame
+ * @param second -- the index of the second frame
+ * @return true if the trimmed frames are pixel-for-pixel identical
+ */
+bool SpriteSheetExporter::haveSameContent(int first, int second)
+{
+    QRect firstRect = trimmedFrames[first].trimRect;
+    QRect secondRect = trimmedFrames[second].trimRect;
+    if (firstRect.size() != secondRect.size())
+        return false;
+    if (frames[first].cacheKey() == frames[second].cacheKey())
+        return true;
+
+    size_t rowBytes = firstRect.width() * sizeof(QRgb);
+    for (int y = 0; y < firstRect.height(); y++)
+    {
+        const uchar* firstRow = frames[first].constScanLine(firstRect.y() + y) + firstRect.x() * sizeof(QRgb);
+        const uchar* secondRow = frames[second].constScanLine(secondRect.y() + y) + secondRect.x() * sizeof(QRgb);
+        if (memcmp(firstRow, secondRow, rowBytes) != 0)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief SpriteSheetExporter::deduplicateFrames
+ * Assigns every non-empty frame to a unique atlas entry. Frames whose trimmed pixels
+ * are identical share one entry; hashes narrow down the candidates before comparing pixels.
+ */
+void SpriteSheetExporter::deduplicateFrames()
+{
+    uniqueFrames.clear();
+    QHash<size_t, QList<int>> uniqueByHash;
+
+    for (int i = 0; i < trimmedFrames.count(); i++)
+    {
+        TrimmedFrame& trimmed = trimmedFrames[i];
+        if (trimmed.trimRect.isEmpty())
+            continue;
+
+        QList<int>& candidates = uniqueByHash[trimmed.hash];
+        for (int uniqueIndex : candidates)
+        {
+            if (haveSameContent(uniqueFrames[uniqueIndex], i))
+            {
+                trimmed.uniqueIndex = uniqueIndex;
+                break;
+            }
+        }
+
+        if (trimmed.uniqueIndex < 0)
+        {
+            trimmed.uniqueIndex = uniqueFrames.count();
+            candidates.append(trimmed.uniqueIndex);
+            uniqueFrames.append(i);
+        }
+    }
+}
+
+/**
+ * @brief SpriteSheetExporter::packFrames
+ * Packs the unique trimmed frames into the smallest power-of-two atlas they fit in.
+ * Packing starts from the smallest size that could hold all frames, and alternately
+ * doubles the width and height until every frame fits.
+ *
+ * @return true if the frames fit into an atlas no larger than the maximum size
+ */
+bool SpriteSheetExporter::packFrames()
+{
+    // Place the tallest frames first; MaxRects packs noticeably tighter that way.
+    QList<int> packingOrder;
+    qint64 totalArea = 0;
+    int largestSide = 1;
+    for (int i = 0; i < uniqueFrames.count(); i++)
+    {
+        QSize size = trimmedFrames[uniqueFrames[i]].trimRect.size() + QSize(PADDING, PADDING);
+        totalArea += qint64(size.width()) * size.height();
+        largestSide = qMax(largestSide, qMax(size.width(), size.height()));
+        packingOrder.append(i);
+    }
+    std::sort(packingOrder.begin(), packingOrder.end(), [this](int first, int second) {
+        QSize firstSize = trimmedFrames[uniqueFrames[first]].trimRect.size();
+        QSize secondSize = trimmedFrames[uniqueFrames[second]].trimRect.size();
+        if (firstSize.height() != secondSize.height())
+            return firstSize.height() > secondSize.height();
+        return firstSize.width() > secondSize.width();
+    });
+
+    int width = 1;
+    while (qint64(width) * width < totalArea || width < largestSide)
+        width *= 2;
+    int height = width;
+
+    while (width <= MAX_ATLAS_SIZE && height <= MAX_ATLAS_SIZE)
+    {
+        MaxRectsBin bin(width, height);
+        placements = QList<QRect>(uniqueFrames.count());
+
+        bool allPlaced = true;
+        for (int i : packingOrder)
+        {
+            QSize size = trimmedFrames[uniqueFrames[i]].trimRect.size();
+            QRect placement = bin.insert(size + QSize(PADDING, PADDING));
+            if (placement.isNull())
+            {
+                allPlaced = false;
+                break;
+            }
+            placements[i] = QRect(placement.topLeft(), size);
+        }
+
+        if (allPlaced)
+        {
+            atlasSize = QSize(width, height);
+            return true;
+        }
+
+        if (width <= height)
+            width *= 2;
+        else
+            height *= 2;
+    }
+
+    return false;
+}
+
+/**
+ * @brief SpriteSheetExporter::composeAtlas
+ * Copies the trimmed pixels of every unique frame into its place in the atlas.
+ *
+ * @return the atlas image
+ */
+QImage SpriteSheetExporter::composeAtlas()
+{
+    QImage atlas(atlasSize, QImage::Format_ARGB32);
+    atlas.fill(Qt::transparent);
+
+    for (int i = 0; i < uniqueFrames.count(); i++)
+    {
+        const QImage& frame = frames[uniqueFrames[i]];
+        QRect source = trimmedFrames[uniqueFrames[i]].trimRect;
+        QPoint destination = placements[i].topLeft();
+
+        for (int y = 0; y < source.height(); y++)
+            memcpy(atlas.scanLine(destination.y() + y) + destination.x() * sizeof(QRgb),
+                   frame.constScanLine(source.y() + y) + source.x() * sizeof(QRgb),
+                   source.width() * sizeof(QRgb));
+    }
+
+    return atlas;
+}
+
+/**
+ * @brief SpriteSheetExporter::writeMetadata
+ * Writes the JSON table that maps every frame (in animation order) to its rectangle in
+ * the atlas and to the offset needed to restore it to its original, untrimmed position.
+ *
+ * @param atlasName -- the file name of the atlas image, as referenced by the metadata
+ * @param fileDir -- the path of the metadata file to write
+ * @return true if the file was written, false otherwise
+ */
+bool SpriteSheetExporter::writeMetadata(QString atlasName, QString fileDir)
+{
+    QJsonObject atlasInstance;
+    atlasInstance["image"] = atlasName;
+    atlasInstance["width"] = atlasSize.width();
+    atlasInstance["height"] = atlasSize.height();
+
+    QJsonArray frameEntries;
+    for (int i = 0; i < trimmedFrames.count(); i++)
+    {
+        const TrimmedFrame& trimmed = trimmedFrames[i];
+        QRect placement = trimmed.uniqueIndex < 0 ? QRect() : placements[trimmed.uniqueIndex];
+
+        QJsonObject frameEntry;
+        frameEntry["frame"] = i;
+        frameEntry["x"] = placement.x();
+        frameEntry["y"] = placement.y();
+        frameEntry["w"] = placement.width();
+        frameEntry["h"] = placement.height();
+        frameEntry["offsetX"] = trimmed.trimRect.x();
+        frameEntry["offsetY"] = trimmed.trimRect.y();
+        frameEntry["sourceWidth"] = frames[i].width();
+        frameEntry["sourceHeight"] = frames[i].height();
+
+        // Point duplicate frames at the first frame that owns their pixels.
+        if (trimmed.uniqueIndex >= 0 && uniqueFrames[trimmed.uniqueIndex] != i)
+            frameEntry["duplicateOf"] = uniqueFrames[trimmed.uniqueIndex];
+
+        frameEntries.append(frameEntry);
+    }
+    atlasInstance["frames"] = frameEntries;
+
+    QFile file(fileDir);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    file.write(QJsonDocument(atlasInstance).toJson());
+    file.close();
+    return true;
+}
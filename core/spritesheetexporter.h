@@ -0,0 +1,65 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the class definition for the SpriteSheetExporter class.
+ */
+
+
+#ifndef SPRITESHEETEXPORTER_H
+#define SPRITESHEETEXPORTER_H
+
+#include <QImage>
+#include <QList>
+#include <QRect>
+#include <QString>
+
+
+/**
+ * @brief The SpriteSheetExporter class
+ * This class packs the frames of a sprite into a single texture atlas. Each frame is
+ * trimmed to its opaque bounds, identical frames are stored only once, and the trimmed
+ * frames are packed with a MaxRects bin packer. The atlas is written as a PNG alongside
+ * a JSON table describing where each frame lives in the atlas.
+ */
+class SpriteSheetExporter
+{
+public:
+    explicit SpriteSheetExporter(QList<QImage>);
+    bool exportTo(QString);
+
+private:
+    /**
+     * @brief The TrimmedFrame struct
+     * The opaque bounds and content hash of a single frame, along with the
+     * atlas placement shared by every frame with identical content.
+     */
+    struct TrimmedFrame
+    {
+        QRect trimRect;
+        size_t hash = 0;
+        int uniqueIndex = -1;
+    };
+
+    static const int PADDING = 1;
+    static const int MAX_ATLAS_SIZE = 16384;
+
+    QList<QImage> frames;
+    QList<TrimmedFrame> trimmedFrames;
+    QList<int> uniqueFrames;
+    QList<QRect> placements;
+    QSize atlasSize;
+
+    static TrimmedFrame trimFrame(const QImage&);
+    bool haveSameContent(int, int);
+    void deduplicateFrames();
+    bool packFrames();
+    QImage composeAtlas();
+    bool writeMetadata(QString, QString);
+};
+
+#endif // SPRITESHEETEXPORTER_H
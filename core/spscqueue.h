@@ -0,0 +1,83 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the class definition for the SpscQueue class template.
+ */
+
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+
+/**
+ * @brief The SpscQueue class template
+ * A bounded, lock-free queue between exactly one producer thread and one consumer thread.
+ * Items live in a fixed ring of slots; the producer only writes the tail index and the
+ * consumer only writes the head index, so neither ever waits on the other. The capacity
+ * must be a power of two; one slot is kept empty to tell a full ring from an empty one.
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    /**
+     * @brief SpscQueue::push
+     * Adds an item at the back of the queue. Only the producer thread may call this.
+     *
+     * @param item -- the item to add
+     * @return true if the item was added, false if the queue is full
+     */
+    bool push(T item)
+    {
+        std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+        std::size_t nextTail = (tail + 1) & MASK;
+        if (nextTail == headIndex.load(std::memory_order_acquire))
+            return false;
+
+        slots[tail] = std::move(item);
+        tailIndex.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief SpscQueue::pop
+     * Removes the item at the front of the queue. Only the consumer thread may call this.
+     *
+     * @param item -- set to the removed item
+     * @return true if an item was removed, false if the queue is empty
+     */
+    bool pop(T& item)
+    {
+        std::size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire))
+            return false;
+
+        item = std::move(slots[head]);
+        slots[head] = T();
+        headIndex.store((head + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    std::array<T, Capacity> slots;
+
+    // The indices are kept on separate cache lines, so that the two threads don't contend for one.
+    alignas(64) std::atomic<std::size_t> headIndex{0};
+    alignas(64) std::atomic<std::size_t> tailIndex{0};
+};
+
+#endif // SPSCQUEUE_H
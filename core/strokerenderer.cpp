@@ -0,0 +1,216 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the implementation of the class definition located in strokerenderer.h.
+ */
+
+
+#include "strokerenderer.h"
+#include "tracer.h"
+
+
+/**
+ * @brief StrokeRenderer::StrokeRenderer
+ * Constructor. Starts the worker thread, which sleeps until the first input arrives.
+ *
+ * @param parent -- QObject parent object
+ */
+StrokeRenderer::StrokeRenderer(QObject *parent)
+    : QObject(parent)
+{
+    workerThread = QThread::create([this](){renderInputs();});
+    workerThread->start();
+}
+
+/**
+ * @brief StrokeRenderer::~StrokeRenderer
+ * Destructor. Lets the worker finish the inputs already queued, then stops it.
+ */
+StrokeRenderer::~StrokeRenderer()
+{
+    StrokeInput stop;
+    stop.kind = StrokeInput::STOP;
+    pushInput(stop);
+    workerThread->wait();
+    delete workerThread;
+}
+
+/**
+ * @brief StrokeRenderer::beginStroke
+ * Starts a stroke on the given frame. The worker draws on its own copy, which shares the
+ * frame's pixels until its first change.
+ *
+ * @param frame -- the frame the stroke is drawn on
+ */
+void StrokeRenderer::beginStroke(const QImage& frame)
+{
+    beginStroke(QList<QImage>{frame});
+}
+
+/**
+ * @brief StrokeRenderer::beginStroke
+ * Starts a stroke drawn on several frames at once. Each pixel of the stroke is drawn on every
+ * frame, and only changes the frames where it has a different color.
+ *
+ * @param frames -- the frames the stroke is drawn on
+ */
+void StrokeRenderer::beginStroke(const QList<QImage>& frames)
+{
+    StrokeInput begin;
+    begin.kind = StrokeInput::BEGIN;
+    begin.frames = frames;
+    pushInput(begin);
+}
+
+/**
+ * @brief StrokeRenderer::addPixel
+ * Queues a pixel of the stroke for the worker, without waiting for it to be drawn.
+ *
+ * @param pixel -- the frame coordinates of the pixel
+ * @param color -- the color to give the pixel
+ */
+void StrokeRenderer::addPixel(QPoint pixel, QRgb color)
+{
+    StrokeInput input;
+    input.pixel = pixel;
+    input.color = color;
+    pushInput(input);
+}
+
+/**
+ * @brief StrokeRenderer::flush
+ * Waits until every queued input has been drawn and published, so that the next batch
+ * taken holds the whole stroke so far. The wait is only as long as the queue's backlog.
+ */
+void StrokeRenderer::flush()
+{
+    TRACE_SCOPE("flushStroke");
+
+    StrokeInput flush;
+    flush.kind = StrokeInput::FLUSH;
+    pushInput(flush);
+    flushed.acquire();
+}
+
+/**
+ * @brief StrokeRenderer::endStroke
+ * Ends the stroke. The worker lets go of its copies of the frames, which stop sharing pixels
+ * with the frames once the stroke has changed them, so they would otherwise be held until
+ * the next stroke begins.
+ */
+void StrokeRenderer::endStroke()
+{
+    StrokeInput end;
+    end.kind = StrokeInput::END;
+    pushInput(end);
+}
+
+/**
+ * @brief StrokeRenderer::takeRenderedBatch
+ * Takes the frames changed since the last batch was taken.
+ *
+ * @return the changed frames, as drawn so far, and the region the changes lie in
+ */
+StrokeRenderer::RenderedBatch StrokeRenderer::takeRenderedBatch()
+{
+    QMutexLocker locker(&batchMutex);
+    RenderedBatch batch = std::move(renderedBatch);
+    renderedBatch = RenderedBatch();
+    return batch;
+}
+
+/**
+ * @brief StrokeRenderer::pushInput
+ * Queues an input for the worker and wakes it.
+ *
+ * @param input -- the input to queue
+ */
+void StrokeRenderer::pushInput(StrokeInput input)
+{
+    // The worker always empties the queue, so a full queue only means waiting for it to catch up.
+    while (!inputs.push(input))
+        QThread::yieldCurrentThread();
+    inputsAvailable.release();
+}
+
+/**
+ * @brief StrokeRenderer::renderInputs
+ * The worker's loop. Sleeps until inputs are queued, draws every queued input on each
+ * frame, then publishes the changed frames as one batch and tells the GUI thread, unless a
+ * notification is already on its way.
+ */
+void StrokeRenderer::renderInputs()
+{
+    StrokeInput input;
+    QList<int> changedFrames;
+    QRect dirtyRect;
+    bool stopping = false;
+
+    auto publish = [&]()
+    {
+        if (changedFrames.isEmpty())
+            return;
+
+        // A frame not yet taken is replaced by its newer state, which includes every change since.
+        {
+            QMutexLocker locker(&batchMutex);
+            for (int frame : changedFrames)
+                renderedBatch.frames.insert(frame, canvases.at(frame));
+            renderedBatch.dirtyRect |= dirtyRect;
+        }
+        changedFrames.clear();
+        dirtyRect = QRect();
+
+        if (!notifyPending.exchange(true))
+            QMetaObject::invokeMethod(this, [this](){notifyPending.store(false); emit batchReady();},
+                                      Qt::QueuedConnection);
+    };
+
+    while (!stopping)
+    {
+        inputsAvailable.acquire();
+
+        // Each input is counted once it is queued, so every count taken has an input waiting.
+        do
+        {
+            inputs.pop(input);
+            switch (input.kind)
+            {
+            case StrokeInput::BEGIN:
+                canvases = input.frames;
+                break;
+            case StrokeInput::PIXEL:
+                for (int frame = 0; frame < canvases.count(); frame++)
+                {
+                    QImage& canvas = canvases[frame];
+                    if (canvas.rect().contains(input.pixel) && canvas.pixel(input.pixel) != input.color)
+                    {
+                        canvas.setPixel(input.pixel, input.color);
+                        dirtyRect |= QRect(input.pixel, QSize(1, 1));
+                        if (!changedFrames.contains(frame))
+                            changedFrames.append(frame);
+                    }
+                }
+                break;
+            case StrokeInput::FLUSH:
+                publish();
+                flushed.release();
+                break;
+            case StrokeInput::END:
+                publish();
+                canvases.clear();
+                break;
+            case StrokeInput::STOP:
+                stopping = true;
+                break;
+            }
+        } while (inputsAvailable.tryAcquire());
+
+        publish();
+    }
+}
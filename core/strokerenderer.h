@@ -0,0 +1,99 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the class definition for the StrokeRenderer class.
+ */
+
+
+#ifndef STROKERENDERER_H
+#define STROKERENDERER_H
+
+#include "spscqueue.h"
+#include <QImage>
+#include <QList>
+#include <QMap>
+#include <QMutex>
+#include <QObject>
+#include <QPoint>
+#include <QRect>
+#include <QSemaphore>
+#include <QThread>
+#include <atomic>
+
+
+/**
+ * @brief The StrokeRenderer class
+ * Applies the pixels of a stroke on a worker thread. The GUI thread pushes each input onto
+ * a lock-free queue and returns to its events at once; the worker draws the inputs onto its
+ * own copy of the frame, skipping pixels that already have the color, and publishes each
+ * frame it changed, whole, as one batch. Whenever a batch is ready, batchReady is emitted on
+ * the GUI thread, which swaps the finished frames into the document without touching their
+ * pixels. A published frame shares its pixels with the worker's copy until the worker next
+ * draws on it, so the copying is left to the worker. While the GUI thread is busy, inputs
+ * pile up into the same batch, so a burst of input costs one repaint. A stroke may be drawn
+ * on several frames at once, in which case each input is drawn on every frame in turn.
+ */
+class StrokeRenderer : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * The frames changed since the last batch was taken, as the stroke has left them, and
+     * the region the changes lie in. Each frame is keyed by its position among the frames
+     * the stroke was begun on.
+     */
+    struct RenderedBatch
+    {
+        QRect dirtyRect;
+        QMap<int, QImage> frames;
+    };
+
+    explicit StrokeRenderer(QObject *parent = nullptr);
+    ~StrokeRenderer();
+
+    void beginStroke(const QImage&);
+    void beginStroke(const QList<QImage>&);
+    void addPixel(QPoint, QRgb);
+    void flush();
+    void endStroke();
+    RenderedBatch takeRenderedBatch();
+
+private:
+    /**
+     * A message from the GUI thread to the worker. Only a BEGIN message carries frames.
+     */
+    struct StrokeInput
+    {
+        enum Kind { BEGIN, PIXEL, FLUSH, END, STOP };
+        Kind kind = PIXEL;
+        QPoint pixel;
+        QRgb color = 0;
+        QList<QImage> frames;
+    };
+
+    static const int INPUT_QUEUE_SIZE = 4096;
+    SpscQueue<StrokeInput, INPUT_QUEUE_SIZE> inputs;
+    QSemaphore inputsAvailable;
+    QSemaphore flushed;
+
+    QThread* workerThread;
+    QList<QImage> canvases;
+
+    QMutex batchMutex;
+    RenderedBatch renderedBatch;
+    std::atomic<bool> notifyPending{false};
+
+    void pushInput(StrokeInput);
+    void renderInputs();
+
+signals:
+    void batchReady();
+};
+
+#endif // STROKERENDERER_H
@@ -0,0 +1,136 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the implementation of the class definitions located in tracer.h.
+ */
+
+
+#include "tracer.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QThread>
+
+
+/**
+ * @brief Tracer::Tracer
+ * Constructor. Starts the clock that all span times are measured against.
+ */
+Tracer::Tracer()
+{
+    clock.start();
+}
+
+/**
+ * @brief Tracer::instance
+ *
+ * @return the tracer shared by the whole application
+ */
+Tracer& Tracer::instance()
+{
+    static Tracer tracer;
+    return tracer;
+}
+
+/**
+ * @brief Tracer::now
+ *
+ * @return the time since the tracer was created, in microseconds
+ */
+qint64 Tracer::now() const
+{
+    return clock.nsecsElapsed() / 1000;
+}
+
+/**
+ * @brief Tracer::startFromEnvironment
+ * Starts recording if the SPRITE_EDITOR_TRACE environment variable names an output file.
+ */
+void Tracer::startFromEnvironment()
+{
+    QString environmentDir = qEnvironmentVariable("SPRITE_EDITOR_TRACE");
+    if (!environmentDir.isEmpty())
+        start(environmentDir);
+}
+
+/**
+ * @brief Tracer::start
+ * Discards any previously-recorded spans and starts recording.
+ *
+ * @param fileDir -- the file directory that the trace is written to when recording stops
+ */
+void Tracer::start(QString fileDir)
+{
+    QMutexLocker locker(&mutex);
+    events.clear();
+    traceDir = fileDir;
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Tracer::stop
+ * Stops recording and writes every recorded span to the trace file.
+ *
+ * @return true if a trace was written, false otherwise
+ */
+bool Tracer::stop()
+{
+    if (!enabled.exchange(false))
+        return false;
+
+    QMutexLocker locker(&mutex);
+    QFile file(traceDir);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    // Spans are written by hand rather than through QJsonDocument, since traces can hold
+    // hundreds of thousands of events.
+    QByteArray processId = QByteArray::number(QCoreApplication::applicationPid());
+    QByteArray json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (int i = 0; i < events.count(); i++)
+    {
+        const TraceEvent& event = events[i];
+        json += "{\"name\":\"";
+        json += event.name;
+        json += "\",\"cat\":\"";
+        json += event.category;
+        json += "\",\"ph\":\"X\",\"ts\":";
+        json += QByteArray::number(event.timestamp);
+        json += ",\"dur\":";
+        json += QByteArray::number(event.duration);
+        json += ",\"pid\":";
+        json += processId;
+        json += ",\"tid\":";
+        json += QByteArray::number(quint64(event.threadId));
+        json += i < events.count() - 1 ? "},\n" : "}\n";
+    }
+    json += "]}\n";
+
+    file.write(json);
+    file.close();
+    events.clear();
+    return true;
+}
+
+/**
+ * @brief Tracer::addSpan
+ * Records a completed span, if recording is on.
+ *
+ * @param name -- the name of the span
+ * @param category -- the category of the span
+ * @param startTime -- when the span started, in microseconds
+ * @param duration -- how long the span lasted, in microseconds
+ */
+void Tracer::addSpan(const char* name, const char* category, qint64 startTime, qint64 duration)
+{
+    if (!isEnabled())
+        return;
+
+    quintptr threadId = reinterpret_cast<quintptr>(QThread::currentThreadId());
+    QMutexLocker locker(&mutex);
+    events.append(TraceEvent{name, category, startTime, duration, threadId});
+}
@@ -0,0 +1,109 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the class definitions for the Tracer and TraceSpan classes,
+ * along with the macros used to place trace spans in the editor's hot paths.
+ */
+
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QElapsedTimer>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <atomic>
+
+
+/**
+ * @brief The Tracer class
+ * Records timed spans of the editor's hot paths and writes them out as Chrome trace-event
+ * JSON, which can be opened in chrome://tracing or Perfetto. Recording is started by
+ * setting the SPRITE_EDITOR_TRACE environment variable to an output path, or from the
+ * Tools menu. While recording is off, a span costs a single relaxed atomic load.
+ */
+class Tracer
+{
+public:
+    static Tracer& instance();
+
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+    qint64 now() const;
+
+    void startFromEnvironment();
+    void start(QString);
+    bool stop();
+
+    void addSpan(const char*, const char*, qint64, qint64);
+
+private:
+    Tracer();
+
+    /**
+     * @brief The TraceEvent struct
+     * A single complete ("X") event: a named span with a start time and duration, in microseconds.
+     */
+    struct TraceEvent
+    {
+        const char* name;
+        const char* category;
+        qint64 timestamp;
+        qint64 duration;
+        quintptr threadId;
+    };
+
+    std::atomic<bool> enabled{false};
+    QElapsedTimer clock;
+    QMutex mutex;
+    QList<TraceEvent> events;
+    QString traceDir;
+};
+
+
+/**
+ * @brief The TraceSpan class
+ * Records the time between its construction and destruction as a span in the Tracer.
+ * Names and categories must be string literals, since only the pointers are kept.
+ */
+class TraceSpan
+{
+public:
+    TraceSpan(const char* name, const char* category)
+        : name{name}
+        , category{category}
+        , startTime{Tracer::instance().isEnabled() ? Tracer::instance().now() : -1}
+    {
+
+    }
+
+    ~TraceSpan()
+    {
+        if (startTime >= 0)
+            Tracer::instance().addSpan(name, category, startTime, Tracer::instance().now() - startTime);
+    }
+
+private:
+    const char* name;
+    const char* category;
+    qint64 startTime;
+};
+
+
+// Defining SPRITE_EDITOR_NO_TRACING compiles every span out entirely.
+#ifdef SPRITE_EDITOR_NO_TRACING
+#define TRACE_SCOPE(name)
+#define TRACE_SIGNAL(name, emission) emission
+#else
+#define TRACE_CONCAT_INNER(first, second) first##second
+#define TRACE_CONCAT(first, second) TRACE_CONCAT_INNER(first, second)
+#define TRACE_SCOPE(name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name, "editor")
+#define TRACE_SIGNAL(name, emission) do { TraceSpan traceSpan(name, "signal"); emission; } while (false)
+#endif
+
+#endif // TRACER_H
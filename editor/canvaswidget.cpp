@@ -0,0 +1,417 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the implementation of the class definition located in canvaswidget.h.
+ */
+
+
+#include "canvaswidget.h"
+#include "tracer.h"
+#include <QElapsedTimer>
+#include <QPainter>
+#include <QtMath>
+
+
+/**
+ * @brief CanvasWidget::CanvasWidget
+ * Constructor. Creates an empty canvas; nothing is drawn until a model is set.
+ *
+ * @param parent -- QWidget parent object
+ */
+CanvasWidget::CanvasWidget(QWidget *parent)
+    : QWidget(parent)
+{
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    // Transparent pixels show a checkerboard, one square per frame pixel. The brush is
+    // drawn in frame coordinates, so it scales along with the frame.
+    QImage checker(2, 2, QImage::Format_RGB32);
+    checker.setPixel(0, 0, qRgb(230, 230, 230));
+    checker.setPixel(1, 1, qRgb(230, 230, 230));
+    checker.setPixel(1, 0, qRgb(255, 255, 255));
+    checker.setPixel(0, 1, qRgb(255, 255, 255));
+    checkerBrush = QBrush(checker);
+}
+
+/**
+ * @brief CanvasWidget::setModel
+ * Sets the model whose frames the canvas shows, and fits its canvas to the widget.
+ * The canvas repaints whenever the model's selection changes.
+ *
+ * @param modelParam -- the model to show
+ */
+void CanvasWidget::setModel(SpriteEditorModel* modelParam)
+{
+    model = modelParam;
+    connect(model, &SpriteEditorModel::selectionChanged,
+            this, [this](){update();});
+    zoomToFit();
+}
+
+/**
+ * @brief CanvasWidget::showFrame
+ * Shows the frame with the given index, repainting the whole canvas.
+ *
+ * @param frameIndexParam -- the index of the frame to show
+ */
+void CanvasWidget::showFrame(int frameIndexParam)
+{
+    frameIndex = frameIndexParam;
+    update();
+}
+
+/**
+ * @brief CanvasWidget::updatePixels
+ * Repaints only the part of the canvas covering a region of frame pixels.
+ *
+ * @param pixels -- the frame coordinates of the changed region
+ */
+void CanvasWidget::updatePixels(QRect pixels)
+{
+    QRectF pixelRect(origin + QPointF(pixels.topLeft()) * zoom, QSizeF(pixels.size()) * zoom);
+    update(pixelRect.toAlignedRect().adjusted(-1, -1, 1, 1));
+}
+
+/**
+ * @brief CanvasWidget::getZoom
+ *
+ * @return the number of screen pixels per frame pixel
+ */
+double CanvasWidget::getZoom()
+{
+    return zoom;
+}
+
+/**
+ * @brief CanvasWidget::mapToPixel
+ * Converts a position in the widget to the frame pixel under it.
+ *
+ * @param position -- the position in widget coordinates
+ * @return the frame coordinates of the pixel, which may lie outside the frame
+ */
+QPoint CanvasWidget::mapToPixel(QPointF position)
+{
+    QPointF pixel = mapToFrame(position);
+    return QPoint(qFloor(pixel.x()), qFloor(pixel.y()));
+}
+
+/**
+ * @brief CanvasWidget::mapToFrame
+ * Converts a position in the widget to frame coordinates, keeping the position within the pixel.
+ *
+ * @param position -- the position in widget coordinates
+ * @return the position in frame coordinates, where pixel (x, y) covers [x, x + 1) by [y, y + 1)
+ */
+QPointF CanvasWidget::mapToFrame(QPointF position)
+{
+    return (position - origin) / zoom;
+}
+
+/**
+ * @brief CanvasWidget::mapFromFrame
+ * Converts a position in frame coordinates to the widget, at the current zoom and pan.
+ *
+ * @param position -- the position in frame coordinates
+ * @return the position in widget coordinates
+ */
+QPointF CanvasWidget::mapFromFrame(QPointF position)
+{
+    return origin + position * zoom;
+}
+
+
+// ===================================================
+// ===                 ZOOM AND PAN                ===
+// ===================================================
+
+/**
+ * @brief CanvasWidget::zoomToFit
+ * Zooms so that the whole frame fits the widget, and centers it.
+ */
+void CanvasWidget::zoomToFit()
+{
+    if (model == nullptr)
+        return;
+
+    int canvasSize = model->getCanvasSize();
+    zoom = qBound(MIN_ZOOM, double(qMin(width(), height())) / canvasSize, MAX_ZOOM);
+    origin = QPointF((width() - canvasSize * zoom) / 2, (height() - canvasSize * zoom) / 2);
+
+    invalidateGrid();
+    update();
+    emit zoomChanged(zoom);
+}
+
+/**
+ * @brief CanvasWidget::setZoom
+ * Changes the zoom level, keeping the frame pixel under the anchor point in place.
+ *
+ * @param newZoom -- the new number of screen pixels per frame pixel
+ * @param anchor -- the widget position that stays fixed, usually the cursor
+ */
+void CanvasWidget::setZoom(double newZoom, QPointF anchor)
+{
+    newZoom = qBound(MIN_ZOOM, newZoom, MAX_ZOOM);
+    if (qFuzzyCompare(newZoom, zoom))
+        return;
+
+    origin = anchor - (anchor - origin) * (newZoom / zoom);
+    zoom = newZoom;
+
+    invalidateGrid();
+    update();
+    emit zoomChanged(zoom);
+}
+
+/**
+ * @brief CanvasWidget::wheelEvent
+ * Zooms in or out around the cursor.
+ *
+ * @param event -- mouse wheel event
+ */
+void CanvasWidget::wheelEvent(QWheelEvent* event)
+{
+    double steps = event->angleDelta().y() / 120.0;
+    setZoom(zoom * qPow(ZOOM_STEP, steps), event->position());
+}
+
+/**
+ * @brief CanvasWidget::resizeEvent
+ * Keeps the frame centered in the same place relative to the widget when it is resized.
+ *
+ * @param event -- resize event
+ */
+void CanvasWidget::resizeEvent(QResizeEvent* event)
+{
+    if (event->oldSize().isValid())
+        origin += QPointF(width() - event->oldSize().width(), height() - event->oldSize().height()) / 2;
+    else
+        zoomToFit();
+
+    invalidateGrid();
+}
+
+
+// ===================================================
+// ===                    INPUT                    ===
+// ===================================================
+
+/**
+ * @brief CanvasWidget::containsPixel
+ *
+ * @param pixel -- frame coordinates
+ * @return true if the coordinates lie inside the frame
+ */
+bool CanvasWidget::containsPixel(QPoint pixel)
+{
+    return model != nullptr && QRect(0, 0, model->getCanvasSize(), model->getCanvasSize()).contains(pixel);
+}
+
+/**
+ * @brief CanvasWidget::mousePressEvent
+ * A left click on the frame starts a stroke; a middle click starts panning.
+ *
+ * @param event -- mouse click event
+ */
+void CanvasWidget::mousePressEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::MiddleButton)
+    {
+        panning = true;
+        lastPanPosition = event->position();
+        setCursor(Qt::ClosedHandCursor);
+    }
+    else if (event->button() == Qt::LeftButton)
+    {
+        QPoint pixel = mapToPixel(event->position());
+        if (containsPixel(pixel))
+            emit pixelPressed(pixel);
+    }
+}
+
+/**
+ * @brief CanvasWidget::mouseMoveEvent
+ * Pans while the middle button is held, and continues a stroke while the left button is held.
+ *
+ * @param event -- mouse drag event
+ */
+void CanvasWidget::mouseMoveEvent(QMouseEvent* event)
+{
+    if (panning)
+    {
+        origin += event->position() - lastPanPosition;
+        lastPanPosition = event->position();
+        invalidateGrid();
+        update();
+    }
+    else if (event->buttons() == Qt::LeftButton)
+    {
+        QPoint pixel = mapToPixel(event->position());
+        if (containsPixel(pixel))
+            emit pixelDragged(pixel);
+    }
+}
+
+/**
+ * @brief CanvasWidget::mouseReleaseEvent
+ * Ends panning or the current stroke.
+ *
+ * @param event -- mouse release event
+ */
+void CanvasWidget::mouseReleaseEvent(QMouseEvent* event)
+{
+    if (event->button() == Qt::MiddleButton && panning)
+    {
+        panning = false;
+        unsetCursor();
+    }
+    else if (event->button() == Qt::LeftButton)
+    {
+        emit strokeReleased();
+    }
+}
+
+
+// ===================================================
+// ===                   PAINTING                  ===
+// ===================================================
+
+/**
+ * @brief CanvasWidget::visibleSourceRect
+ * Finds the frame pixels that cover a region of the widget.
+ *
+ * @param widgetRect -- the region in widget coordinates
+ * @return the covering pixels in frame coordinates, clipped to the frame
+ */
+QRect CanvasWidget::visibleSourceRect(QRect widgetRect)
+{
+    QPointF topLeft = (QPointF(widgetRect.topLeft()) - origin) / zoom;
+    QPointF bottomRight = (QPointF(widgetRect.topLeft() + QPoint(widgetRect.width(), widgetRect.height())) - origin) / zoom;
+    QRect source(QPoint(qFloor(topLeft.x()), qFloor(topLeft.y())),
+                 QPoint(qCeil(bottomRight.x()) - 1, qCeil(bottomRight.y()) - 1));
+    return source.intersected(QRect(0, 0, model->getCanvasSize(), model->getCanvasSize()));
+}
+
+/**
+ * @brief CanvasWidget::paintEvent
+ * Draws the visible part of the frame over its checkerboard, then any floating selection
+ * over the frame, the grid if it is shown, and the outline of the selection.
+ *
+ * @param event -- paint event holding the region to repaint
+ */
+void CanvasWidget::paintEvent(QPaintEvent* event)
+{
+    TRACE_SCOPE("paintCanvas");
+
+    QElapsedTimer paintTimer;
+    paintTimer.start();
+
+    QPainter painter(this);
+    painter.fillRect(event->rect(), palette().dark());
+
+    if (model != nullptr && frameIndex < model->getFrameCount())
+    {
+        QRect source = visibleSourceRect(event->rect());
+        if (!source.isEmpty())
+        {
+            // Draw in frame coordinates. Without smooth transformation, scaling samples the
+            // nearest frame pixel, and only the source pixels in view are ever touched.
+            painter.save();
+            painter.translate(origin);
+            painter.scale(zoom, zoom);
+            painter.fillRect(source, checkerBrush);
+            painter.drawImage(source, *model->getFrame(frameIndex), source);
+
+            QImage floatingSelection = model->getFloatingSelection();
+            QRect floatingSource = model->getSelectionRect().intersected(source);
+            if (!floatingSelection.isNull() && !floatingSource.isEmpty())
+                painter.drawImage(floatingSource, floatingSelection,
+                                  floatingSource.translated(-model->getSelectionRect().topLeft()));
+            painter.restore();
+        }
+
+        if (gridVisible && zoom >= MIN_GRID_ZOOM)
+        {
+            if (gridCache.isNull())
+                rebuildGrid();
+            painter.drawPixmap(0, 0, gridCache);
+        }
+
+        // The outline is drawn in widget coordinates, so that it stays one screen pixel wide.
+        if (model->hasSelection())
+        {
+            QRect selection = model->getSelectionRect();
+            QRectF outline(origin + QPointF(selection.topLeft()) * zoom, QSizeF(selection.size()) * zoom);
+            painter.setPen(QPen(Qt::white, 0));
+            painter.drawRect(outline);
+            painter.setPen(QPen(Qt::black, 0, Qt::DashLine));
+            painter.drawRect(outline);
+        }
+    }
+
+    emit painted(paintTimer.nsecsElapsed());
+}
+
+/**
+ * @brief CanvasWidget::setGridVisible
+ * Shows or hides the pixel grid overlay.
+ *
+ * @param visible -- whether the grid is shown
+ */
+void CanvasWidget::setGridVisible(bool visible)
+{
+    gridVisible = visible;
+    update();
+}
+
+/**
+ * @brief CanvasWidget::rebuildGrid
+ * Draws the grid lines between the visible frame pixels into a widget-sized overlay.
+ */
+void CanvasWidget::rebuildGrid()
+{
+    gridCache = QPixmap(size() * devicePixelRatio());
+    gridCache.setDevicePixelRatio(devicePixelRatio());
+    gridCache.fill(Qt::transparent);
+
+    QRect source = visibleSourceRect(rect());
+    if (source.isEmpty())
+        return;
+
+    QPainter painter(&gridCache);
+    painter.setPen(QColor(0, 0, 0, 60));
+
+    double top = origin.y() + source.top() * zoom;
+    double bottom = origin.y() + (source.bottom() + 1) * zoom;
+    double left = origin.x() + source.left() * zoom;
+    double right = origin.x() + (source.right() + 1) * zoom;
+
+    for (int x = source.left(); x <= source.right() + 1; x++)
+        painter.drawLine(QLineF(origin.x() + x * zoom, top, origin.x() + x * zoom, bottom));
+    for (int y = source.top(); y <= source.bottom() + 1; y++)
+        painter.drawLine(QLineF(left, origin.y() + y * zoom, right, origin.y() + y * zoom));
+}
+
+/**
+ * @brief CanvasWidget::getGridByteCount
+ *
+ * @return the number of bytes held by the cached grid overlay
+ */
+qint64 CanvasWidget::getGridByteCount()
+{
+    return gridCache.isNull() ? 0 : qint64(gridCache.width()) * gridCache.height() * gridCache.depth() / 8;
+}
+
+/**
+ * @brief CanvasWidget::invalidateGrid
+ * Discards the cached grid, so that it is redrawn for the current zoom and pan.
+ */
+void CanvasWidget::invalidateGrid()
+{
+    gridCache = QPixmap();
+}
@@ -0,0 +1,91 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the class definition for the CanvasWidget class.
+ */
+
+
+#ifndef CANVASWIDGET_H
+#define CANVASWIDGET_H
+
+#include "spriteeditormodel.h"
+#include <QBrush>
+#include <QMouseEvent>
+#include <QPixmap>
+#include <QWidget>
+
+
+/**
+ * @brief The CanvasWidget class
+ * The drawing canvas. Shows one frame of the model at any zoom level, panned anywhere in
+ * the widget. Only the part of the frame inside the repainted region is drawn, with
+ * nearest-neighbor sampling straight from the frame, so painting never allocates a scaled
+ * copy of the frame and costs no more than the widget's size allows. A pixel grid can be
+ * overlaid once pixels are large enough to see it; it is cached until the view changes.
+ */
+class CanvasWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit CanvasWidget(QWidget *parent = nullptr);
+
+    void setModel(SpriteEditorModel*);
+    void showFrame(int);
+    void updatePixels(QRect);
+    double getZoom();
+    QPoint mapToPixel(QPointF);
+    QPointF mapToFrame(QPointF);
+    QPointF mapFromFrame(QPointF);
+    qint64 getGridByteCount();
+    void invalidateGrid();
+
+private:
+    SpriteEditorModel* model = nullptr;
+    int frameIndex = 0;
+
+    double zoom = 1;
+    QPointF origin;
+
+    bool gridVisible = false;
+    QPixmap gridCache;
+    QBrush checkerBrush;
+
+    bool panning = false;
+    QPointF lastPanPosition;
+
+    const double MIN_ZOOM = 0.0625;
+    const double MAX_ZOOM = 128;
+    const double ZOOM_STEP = 1.25;
+    const double MIN_GRID_ZOOM = 6;
+
+    void setZoom(double, QPointF);
+    bool containsPixel(QPoint);
+    QRect visibleSourceRect(QRect);
+    void rebuildGrid();
+
+    void paintEvent(QPaintEvent*) override;
+    void resizeEvent(QResizeEvent*) override;
+    void wheelEvent(QWheelEvent*) override;
+    void mousePressEvent(QMouseEvent*) override;
+    void mouseMoveEvent(QMouseEvent*) override;
+    void mouseReleaseEvent(QMouseEvent*) override;
+
+public slots:
+    void zoomToFit();
+    void setGridVisible(bool);
+
+signals:
+    void pixelPressed(QPoint);
+    void pixelDragged(QPoint);
+    void strokeReleased();
+    void zoomChanged(double);
+    void painted(qint64);
+};
+
+#endif // CANVASWIDGET_H
@@ -12,6 +12,11 @@
 #include "colorpicker.h"
 #include "ui_colorpicker.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COLORPICKER_SSE2
+#endif
+
 
 /**
  * @brief ColorPicker::ColorPicker
@@ -25,6 +30,9 @@ ColorPicker::ColorPicker(QWidget *parent) :
     ui(new Ui::ColorPicker)
 {
     ui->setupUi(this);
+    gradients.setMaxCost(GRADIENT_CACHE_SIZE);
+    changeGradientHue(ui->gradientHueSlider->value());
+    drawSelectionRing();
 
     // Connections for a change in the hue slider value:
     connect(ui->gradientHueSlider, &QSlider::valueChanged,
@@ -46,8 +54,8 @@ ColorPicker::ColorPicker(QWidget *parent) :
 
     // The current clicked point is set to the black part of the canvas.
     // The offset of x+2 and y-3 improves the selection's visual appearance.
-    currPt = QPoint(ui->gradientBackground->x() + 2,
-                    ui->gradientBackground->y() + ui->gradientBackground->width() - 3);
+    moveSelection(QPoint(ui->gradientBackground->x() + 2,
+                         ui->gradientBackground->y() + ui->gradientBackground->width() - 3));
 
     // The recent colors list starts off with the default black.
     drawRecentColors(QList<QColor>{getColorFromCurrentPoint()});
@@ -104,7 +112,7 @@ void ColorPicker::mouseMoveEvent(QMouseEvent *event)
 {
     QPoint movePt = event->position().toPoint();
     if(event->buttons() == Qt::LeftButton && isInGradientBounds(movePt) && movePt != currPt)
-        currPt = movePt;
+        moveSelection(movePt);
 }
 
 /**
@@ -128,7 +136,7 @@ void ColorPicker::mouseReleaseEvent(QMouseEvent *)
  */
 void ColorPicker::updateCurrentColor(QPoint point)
 {
-    currPt = point;
+    moveSelection(point);
     emit updateNewColor(getColorFromCurrentPoint());
 }
 
@@ -154,23 +162,102 @@ QColor ColorPicker::getColorFromCurrentPoint()
     return selectedColor;
 }
 
+/**
+ * @brief ColorPicker::getGradientByteCount
+ *
+ * @return the number of bytes held by the cached saturation/value squares
+ */
+qint64 ColorPicker::getGradientByteCount()
+{
+    int size = ui->gradientBackground->width();
+    return qint64(gradients.size()) * size * size * 4;
+}
+
+/**
+ * @brief ColorPicker::clearGradients
+ * Discards every cached square. The square on screen stays until the hue changes.
+ */
+void ColorPicker::clearGradients()
+{
+    gradients.clear();
+}
+
 /**
  * @brief ColorPicker::changeGradientHue
  * As the slider is moved, the hue is changed, which corresponds to
- * changing the hue of the color gradient square and updating the
- * gradient's stylesheets.
+ * changing the hue of the color gradient square. Squares are rendered
+ * once per hue and cached, so moving back and forth costs nothing.
  *
  * @param value -- the color hue in range of 0 - 359, inclusive.
  */
 void ColorPicker::changeGradientHue(int value)
 {
-    QColor color;
-    color.setHsv(MAX_COLOR_HUE - value, MAX_COLOR_VAL, MAX_COLOR_VAL);
+    int hue = MAX_COLOR_HUE - value;
+    QImage* gradient = gradients.object(hue);
+    if (gradient == nullptr)
+    {
+        gradient = new QImage(renderGradient(hue));
+        gradients.insert(hue, gradient);
+    }
+    ui->gradientBackground->setPixmap(QPixmap::fromImage(*gradient));
+}
 
-    QString colorHSV = QString("hsv(%1, %2, %3), ").arg(color.hue()).arg(color.saturation()).arg(color.value());
-    QString colorStyle = QString("background-color: qlineargradient(spread:pad, x1:1, y1:1, x2:0, y2:0, "
-                                 "stop:0 %1 %2 %3 %4").arg(colorHSV, "stop:0.45", colorHSV, "stop:1 hsv(0, 0, 255));");
-    ui->gradientBackground->setStyleSheet(colorStyle);
+/**
+ * @brief ColorPicker::renderGradient
+ * Renders the saturation/value square of a hue: saturation rises from left to right, and
+ * value falls from top to bottom, as in getColorFromCurrentPoint. At a fixed hue, each
+ * channel is value * (1 - saturation * (1 - the channel of the pure hue)), so once the
+ * per-column factors are known, every pixel is a multiplication per channel. Four pixels
+ * are computed at a time with SSE2 where it is available.
+ *
+ * @param hue -- the hue of the square, in range of 0 - 359, inclusive
+ * @return the square, as large as the gradient label
+ */
+QImage ColorPicker::renderGradient(int hue)
+{
+    int size = ui->gradientBackground->width();
+    QImage gradient(size, size, QImage::Format_RGB32);
+
+    QColor pureHue = QColor::fromHsv(hue, MAX_COLOR_VAL, MAX_COLOR_VAL);
+    QList<float> redFactors(size);
+    QList<float> greenFactors(size);
+    QList<float> blueFactors(size);
+    for (int x = 0; x < size; x++)
+    {
+        float saturation = float(x) / size;
+        redFactors[x] = 1 - saturation * (1 - float(pureHue.redF()));
+        greenFactors[x] = 1 - saturation * (1 - float(pureHue.greenF()));
+        blueFactors[x] = 1 - saturation * (1 - float(pureHue.blueF()));
+    }
+
+    for (int y = 0; y < size; y++)
+    {
+        float value = MAX_COLOR_VAL - y * float(MAX_COLOR_VAL) / size;
+        QRgb* row = reinterpret_cast<QRgb*>(gradient.scanLine(y));
+        int x = 0;
+
+#ifdef COLORPICKER_SSE2
+        __m128 values = _mm_set1_ps(value);
+        __m128 half = _mm_set1_ps(0.5f);
+        __m128i opaque = _mm_set1_epi32(int(0xff000000));
+        for (; x + 4 <= size; x += 4)
+        {
+            __m128i red = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(values, _mm_loadu_ps(redFactors.constData() + x)), half));
+            __m128i green = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(values, _mm_loadu_ps(greenFactors.constData() + x)), half));
+            __m128i blue = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(values, _mm_loadu_ps(blueFactors.constData() + x)), half));
+            __m128i pixels = _mm_or_si128(_mm_or_si128(opaque, _mm_slli_epi32(red, 16)),
+                                          _mm_or_si128(_mm_slli_epi32(green, 8), blue));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + x), pixels);
+        }
+#endif
+
+        // Whatever is left of the row, or all of it without SSE2.
+        for (; x < size; x++)
+            row[x] = qRgb(int(value * redFactors[x] + 0.5f),
+                          int(value * greenFactors[x] + 0.5f),
+                          int(value * blueFactors[x] + 0.5f));
+    }
+    return gradient;
 }
 
 /**
@@ -222,8 +309,8 @@ void ColorPicker::setRecentColorSelection(QPushButton *button)
     // Update the currently-selected point depending on the color's saturation and value components.
     // "colorScale" scales the color values to be evenly-distributed across the gradient square.
     double colorScale = MAX_COLOR_VAL / double(ui->gradientBackground->width());
-    currPt.setX((selectedColor.saturation() / colorScale) + ui->gradientBackground->x());
-    currPt.setY(((MAX_COLOR_VAL - selectedColor.value()) / colorScale) + ui->gradientBackground->y());
+    moveSelection(QPoint((selectedColor.saturation() / colorScale) + ui->gradientBackground->x(),
+                         ((MAX_COLOR_VAL - selectedColor.value()) / colorScale) + ui->gradientBackground->y()));
 
     emit updateNewColor(selectedColor);
 }
@@ -237,8 +324,8 @@ void ColorPicker::setRecentColorSelection(QPushButton *button)
 void ColorPicker::resetColorPalette()
 {
     // The currently-selected point is set to the default position.
-    currPt = QPoint(ui->gradientBackground->x() + 2,
-                       ui->gradientBackground->y() + ui->gradientBackground->width() - 3);
+    moveSelection(QPoint(ui->gradientBackground->x() + 2,
+                         ui->gradientBackground->y() + ui->gradientBackground->width() - 3));
 
     QColor currColor = getColorFromCurrentPoint();
     drawRecentColors(QList<QColor>{currColor});
@@ -248,27 +335,44 @@ void ColorPicker::resetColorPalette()
 }
 
 /**
- * @brief ColorPicker::paintEvent
- * Draws a circle on the gradient to represent the currently-selected color.
+ * @brief ColorPicker::drawSelectionRing
+ * Draws the circle that marks the currently-selected color on the gradient. It is drawn
+ * once, into a pixmap just large enough to hold it, which the selection layer then shows.
  */
-void ColorPicker::paintEvent(QPaintEvent *)
+void ColorPicker::drawSelectionRing()
 {
     // Set up the transparent layer for painting.
-    QPixmap drawLayer(ui->selectionLayer->width(), ui->selectionLayer->width());
-    drawLayer.fill(Qt::transparent);
-    QPainter painter(&drawLayer);
+    int ringSize = 2 * SELECTION_RADIUS + 2;
+    selectionRing = QPixmap(ringSize, ringSize);
+    selectionRing.fill(Qt::transparent);
+    QPainter painter(&selectionRing);
+    QPointF center(ringSize / 2.0, ringSize / 2.0);
 
-    // A black circle is drawn at the currently selected location.
+    // A black circle is drawn at the center of the layer.
     QPen pen(Qt::black);
     pen.setWidth(2);
     painter.setPen(pen);
-    int radius = 6;
-    painter.drawEllipse(QPointF(currPt.x(), currPt.y()), radius, radius);
+    painter.drawEllipse(center, SELECTION_RADIUS, SELECTION_RADIUS);
 
-    // An inner white circle is drawn at the currently selected location.
+    // An inner white circle is drawn inside it.
     pen.setColor(Qt::white);
     painter.setPen(pen);
-    painter.drawEllipse(QPointF(currPt.x(), currPt.y()), radius - 2, radius - 2);
+    painter.drawEllipse(center, SELECTION_RADIUS - 2, SELECTION_RADIUS - 2);
+    painter.end();
 
-    ui->selectionLayer->setPixmap(drawLayer);
+    ui->selectionLayer->setPixmap(selectionRing);
+    ui->selectionLayer->resize(selectionRing.size());
+}
+
+/**
+ * @brief ColorPicker::moveSelection
+ * Sets the currently-selected point, and moves the selection ring over it.
+ *
+ * @param point -- the newly selected point
+ */
+void ColorPicker::moveSelection(QPoint point)
+{
+    currPt = point;
+    QPoint ringCenter(selectionRing.width() / 2, selectionRing.height() / 2);
+    ui->selectionLayer->move(currPt - ui->colorPicker->pos() - ringCenter);
 }
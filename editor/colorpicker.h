@@ -13,6 +13,8 @@
 #define COLORPICKER_H
 
 #include "qpushbutton.h"
+#include <QCache>
+#include <QImage>
 #include <QMouseEvent>
 #include <QPainter>
 
@@ -22,6 +24,10 @@ QT_END_NAMESPACE
 
 /**
  * @brief The ColorPicker class
+ * A saturation/value square beside a hue slider, with swatches of recently picked colors.
+ * The square for each hue is rendered once into an image and cached, and the selection
+ * ring is a small cached pixmap that is moved over the square, so dragging either the
+ * slider or the ring never restyles or repaints more than it has to.
  */
 class ColorPicker : public QWidget
 {
@@ -31,6 +37,9 @@ public:
     explicit ColorPicker(QWidget *parent = nullptr);
     ~ColorPicker();
 
+    qint64 getGradientByteCount();
+    void clearGradients();
+
 private slots:
     void changeGradientHue(int);
     void setRecentColorSelection(QPushButton*);
@@ -47,10 +56,18 @@ private:
 
     QPoint currPt;
 
+    const int GRADIENT_CACHE_SIZE = 64;
+    const int SELECTION_RADIUS = 6;
+    QCache<int, QImage> gradients;
+    QPixmap selectionRing;
+
     void mousePressEvent(QMouseEvent*);
     void mouseMoveEvent(QMouseEvent*);
     void mouseReleaseEvent(QMouseEvent*);
-    void paintEvent(QPaintEvent*);
+
+    QImage renderGradient(int);
+    void drawSelectionRing();
+    void moveSelection(QPoint);
 
     bool isInGradientBounds(QPoint);
     void updateCurrentColor(QPoint);
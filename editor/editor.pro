@@ -0,0 +1,43 @@
+QT       += core gui
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++17
+
+TARGET = A7
+
+include(../core/core.pri)
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+
+SOURCES += \
+    canvaswidget.cpp \
+    colorpicker.cpp \
+    framelistmodel.cpp \
+    framethumbnaildelegate.cpp \
+    inputrecorder.cpp \
+    main.cpp \
+    palettelistmodel.cpp \
+    performancehud.cpp \
+    spriteeditorview.cpp
+
+HEADERS += \
+    canvaswidget.h \
+    colorpicker.h \
+    framelistmodel.h \
+    framethumbnaildelegate.h \
+    inputrecorder.h \
+    palettelistmodel.h \
+    performancehud.h \
+    spriteeditorview.h
+
+FORMS += \
+    colorpicker.ui \
+    spriteeditorview.ui
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
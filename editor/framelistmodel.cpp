@@ -0,0 +1,196 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the implementation of the class definition located in framelistmodel.h.
+ */
+
+
+#include "framelistmodel.h"
+#include "tracer.h"
+
+
+/**
+ * @brief FrameListModel::FrameListModel
+ * Constructor. Creates a list model over the frames of the given document, and keeps
+ * it in step with the frames as they are added, removed, and edited.
+ *
+ * @param document -- the model whose frames to list
+ * @param thumbnailSize -- the width and height of each thumbnail, in pixels
+ * @param parent -- QObject parent object
+ */
+FrameListModel::FrameListModel(SpriteEditorModel* document, int thumbnailSize, QObject *parent)
+    : QAbstractListModel(parent)
+    , document{document}
+    , thumbnailSize{thumbnailSize}
+    , frameCount{document->getFrameCount()}
+{
+    thumbnails.setMaxCost(THUMBNAIL_CACHE_SIZE);
+    placeholderThumbnail = QPixmap(thumbnailSize, thumbnailSize);
+    placeholderThumbnail.fill(Qt::lightGray);
+
+    connect(document, &SpriteEditorModel::framesInserted,
+            this, &FrameListModel::insertFrames);
+    connect(document, &SpriteEditorModel::frameRemoved,
+            this, &FrameListModel::removeFrame);
+    connect(document, &SpriteEditorModel::frameUpdated,
+            this, &FrameListModel::updateFrame);
+    connect(document, &SpriteEditorModel::frameDurationChanged,
+            this, &FrameListModel::updateFrameDuration);
+}
+
+/**
+ * @brief FrameListModel::rowCount
+ *
+ * @param parent -- unused, since the list is flat
+ * @return the number of frames the view knows about
+ */
+int FrameListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return frameCount;
+}
+
+/**
+ * @brief FrameListModel::data
+ * Returns the thumbnail of a frame, rendering and caching it if it is not already cached.
+ * A frame that hasn't been read yet gets a placeholder instead.
+ *
+ * @param index -- the index of the row
+ * @param role -- the role of the data to return
+ * @return the frame's thumbnail for the decoration role, or its number (and its hold, if it
+ *         lasts more than one tick) for the display role
+ */
+QVariant FrameListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= frameCount)
+        return QVariant();
+
+    int frameIndex = index.row();
+    if (role == Qt::DisplayRole || role == Qt::ToolTipRole)
+    {
+        int duration = document->getFrameDuration(frameIndex);
+        if (duration > 1)
+            return QString("Frame %1 (\u00d7%2)").arg(frameIndex + 1).arg(duration);
+        return QString("Frame %1").arg(frameIndex + 1);
+    }
+    if (role != Qt::DecorationRole)
+        return QVariant();
+
+    // Placeholders aren't cached, so the frame is rendered as soon as it is read.
+    if (frameIndex >= document->getLoadedFrameCount())
+        return placeholderThumbnail;
+
+    if (QPixmap* cached = thumbnails.object(frameIndex))
+        return *cached;
+
+    TRACE_SCOPE("renderThumbnail");
+    QPixmap* thumbnail = new QPixmap(QPixmap::fromImage(document->getFrame(frameIndex)->scaled(
+                thumbnailSize, thumbnailSize, Qt::IgnoreAspectRatio, Qt::FastTransformation)));
+    QPixmap result = *thumbnail;
+    thumbnails.insert(frameIndex, thumbnail);
+    return result;
+}
+
+/**
+ * @brief FrameListModel::flags
+ * A frame that hasn't been read yet can't be selected, since there is nothing to draw on.
+ *
+ * @param index -- the index of the row
+ * @return the row's item flags
+ */
+Qt::ItemFlags FrameListModel::flags(const QModelIndex& index) const
+{
+    if (index.isValid() && index.row() >= document->getLoadedFrameCount())
+        return Qt::NoItemFlags;
+    return QAbstractListModel::flags(index);
+}
+
+/**
+ * @brief FrameListModel::getThumbnailByteCount
+ *
+ * @return the number of bytes held by the cached thumbnails
+ */
+qint64 FrameListModel::getThumbnailByteCount() const
+{
+    return qint64(thumbnails.size()) * thumbnailSize * thumbnailSize * 4;
+}
+
+/**
+ * @brief FrameListModel::clearThumbnails
+ * Discards every cached thumbnail. Visible rows render theirs again when next painted.
+ */
+void FrameListModel::clearThumbnails()
+{
+    thumbnails.clear();
+}
+
+/**
+ * @brief FrameListModel::insertFrames
+ * Adds rows for frames that were inserted into the document.
+ *
+ * @param firstFrameIndex -- the index of the first inserted frame
+ * @param count -- the number of inserted frames
+ */
+void FrameListModel::insertFrames(int firstFrameIndex, int count)
+{
+    // Inserting anywhere but the end shifts the frames that the cached thumbnails belong to.
+    if (firstFrameIndex < frameCount)
+        thumbnails.clear();
+
+    beginInsertRows(QModelIndex(), firstFrameIndex, firstFrameIndex + count - 1);
+    frameCount += count;
+    endInsertRows();
+}
+
+/**
+ * @brief FrameListModel::removeFrame
+ * Removes the row of a frame that was removed from the document.
+ *
+ * @param frameIndex -- the index the removed frame had
+ */
+void FrameListModel::removeFrame(int frameIndex)
+{
+    thumbnails.clear();
+
+    beginRemoveRows(QModelIndex(), frameIndex, frameIndex);
+    frameCount--;
+    endRemoveRows();
+}
+
+/**
+ * @brief FrameListModel::updateFrame
+ * Discards the thumbnail of a frame whose pixels changed, so that it is rendered again
+ * the next time it is visible.
+ *
+ * @param frameIndex -- the index of the changed frame
+ */
+void FrameListModel::updateFrame(int frameIndex)
+{
+    if (frameIndex >= frameCount)
+        return;
+
+    thumbnails.remove(frameIndex);
+    QModelIndex changed = index(frameIndex);
+    emit dataChanged(changed, changed, {Qt::DecorationRole});
+}
+
+/**
+ * @brief FrameListModel::updateFrameDuration
+ * Relabels a frame whose hold changed. Its thumbnail is still current.
+ *
+ * @param frameIndex -- the index of the changed frame
+ */
+void FrameListModel::updateFrameDuration(int frameIndex)
+{
+    if (frameIndex >= frameCount)
+        return;
+
+    QModelIndex changed = index(frameIndex);
+    emit dataChanged(changed, changed, {Qt::DisplayRole, Qt::ToolTipRole});
+}
@@ -0,0 +1,59 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the class definition for the FrameListModel class.
+ */
+
+
+#ifndef FRAMELISTMODEL_H
+#define FRAMELISTMODEL_H
+
+#include "spriteeditormodel.h"
+#include <QAbstractListModel>
+#include <QCache>
+#include <QPixmap>
+
+
+/**
+ * @brief The FrameListModel class
+ * Exposes the frames of a SpriteEditorModel to a list view, one row per frame, with each
+ * frame's thumbnail as its decoration. Thumbnails are only rendered when a visible row asks
+ * for them, and are kept in a bounded cache that is invalidated whenever a frame changes.
+ * Frames of a file still being opened show a placeholder until they are read.
+ */
+class FrameListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    FrameListModel(SpriteEditorModel* document, int thumbnailSize, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+
+    qint64 getThumbnailByteCount() const;
+    void clearThumbnails();
+
+private:
+    SpriteEditorModel* document;
+    int thumbnailSize;
+    int frameCount;
+
+    const int THUMBNAIL_CACHE_SIZE = 256;
+    mutable QCache<int, QPixmap> thumbnails;
+    QPixmap placeholderThumbnail;
+
+public slots:
+    void insertFrames(int, int);
+    void removeFrame(int);
+    void updateFrame(int);
+    void updateFrameDuration(int);
+};
+
+#endif // FRAMELISTMODEL_H
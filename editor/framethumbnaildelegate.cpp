@@ -0,0 +1,64 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the implementation of the class definition located in framethumbnaildelegate.h.
+ */
+
+
+#include "framethumbnaildelegate.h"
+#include <QPainter>
+
+
+/**
+ * @brief FrameThumbnailDelegate::FrameThumbnailDelegate
+ * Constructor. Creates a delegate for thumbnails of the given size.
+ *
+ * @param thumbnailSize -- the width and height of each thumbnail, in pixels
+ * @param parent -- QObject parent object
+ */
+FrameThumbnailDelegate::FrameThumbnailDelegate(int thumbnailSize, QObject *parent)
+    : QStyledItemDelegate(parent)
+    , thumbnailSize{thumbnailSize}
+{
+
+}
+
+/**
+ * @brief FrameThumbnailDelegate::paint
+ * Draws the thumbnail of a frame, on a blue background if it is the selected frame.
+ *
+ * @param painter -- the painter of the list's viewport
+ * @param option -- the style and geometry of the row
+ * @param index -- the index of the row
+ */
+void FrameThumbnailDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    painter->save();
+
+    if (option.state & QStyle::State_Selected)
+        painter->fillRect(option.rect, Qt::blue);
+
+    QPixmap thumbnail = index.data(Qt::DecorationRole).value<QPixmap>();
+    QRect thumbnailRect(0, 0, thumbnailSize, thumbnailSize);
+    thumbnailRect.moveCenter(option.rect.center());
+    painter->drawPixmap(thumbnailRect, thumbnail);
+
+    painter->restore();
+}
+
+/**
+ * @brief FrameThumbnailDelegate::sizeHint
+ *
+ * @param option -- unused
+ * @param index -- unused
+ * @return the size of every row: a thumbnail with a margin on each side
+ */
+QSize FrameThumbnailDelegate::sizeHint(const QStyleOptionViewItem&, const QModelIndex&) const
+{
+    return QSize(thumbnailSize + 2 * MARGIN, thumbnailSize + 2 * MARGIN);
+}
@@ -0,0 +1,39 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Caden Erickson
+ *
+ * This file contains the class definition for the FrameThumbnailDelegate class.
+ */
+
+
+#ifndef FRAMETHUMBNAILDELEGATE_H
+#define FRAMETHUMBNAILDELEGATE_H
+
+#include <QStyledItemDelegate>
+
+
+/**
+ * @brief The FrameThumbnailDelegate class
+ * Paints a row of the frame list as the frame's thumbnail, highlighted when it is the
+ * selected frame. Every row has the same size, so the list never needs to measure them.
+ */
+class FrameThumbnailDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    FrameThumbnailDelegate(int thumbnailSize, QObject *parent = nullptr);
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+private:
+    int thumbnailSize;
+    const int MARGIN = 4;
+};
+
+#endif // FRAMETHUMBNAILDELEGATE_H
@@ -0,0 +1,239 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the implementation of the class definition located in inputrecorder.h.
+ */
+
+
+#include "inputrecorder.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMouseEvent>
+
+
+/**
+ * @brief inputTypeName
+ *
+ * @param type -- a mouse event type
+ * @return the name the type is recorded under
+ */
+static QString inputTypeName(QEvent::Type type)
+{
+    if (type == QEvent::MouseButtonPress)
+        return "press";
+    if (type == QEvent::MouseButtonRelease)
+        return "release";
+    return "move";
+}
+
+/**
+ * @brief inputTypeFromName
+ *
+ * @param name -- the name a type is recorded under
+ * @return the mouse event type, or QEvent::None if the name isn't one
+ */
+static QEvent::Type inputTypeFromName(QString name)
+{
+    if (name == "press")
+        return QEvent::MouseButtonPress;
+    if (name == "release")
+        return QEvent::MouseButtonRelease;
+    if (name == "move")
+        return QEvent::MouseMove;
+    return QEvent::None;
+}
+
+
+/**
+ * @brief InputRecorder::InputRecorder
+ * Constructor. Watches the canvas for mouse events; nothing is kept until recording starts.
+ *
+ * @param canvas -- the canvas whose input to record
+ * @param model -- the model shown on the canvas
+ * @param parent -- QObject parent object
+ */
+InputRecorder::InputRecorder(CanvasWidget* canvas, SpriteEditorModel* model, QObject *parent)
+    : QObject(parent)
+    , canvas{canvas}
+    , model{model}
+{
+    canvas->installEventFilter(this);
+}
+
+/**
+ * @brief InputRecorder::isRecording
+ *
+ * @return true if input is being recorded
+ */
+bool InputRecorder::isRecording()
+{
+    return recording;
+}
+
+/**
+ * @brief InputRecorder::start
+ * Discards any previously-recorded input and starts recording.
+ *
+ * @param fileDir -- the file directory that the recording is written to when recording stops
+ */
+void InputRecorder::start(QString fileDir)
+{
+    inputs.clear();
+    recordingDir = fileDir;
+    recordedCanvasSize = model->getCanvasSize();
+    clock.start();
+    recording = true;
+}
+
+/**
+ * @brief InputRecorder::stop
+ * Stops recording and writes every recorded input to the recording file.
+ *
+ * @return true if a recording was written, false otherwise
+ */
+bool InputRecorder::stop()
+{
+    if (!recording)
+        return false;
+    recording = false;
+
+    QJsonArray inputArray;
+    for (const RecordedInput& input : inputs)
+    {
+        QJsonObject inputObject;
+        inputObject["type"] = inputTypeName(input.type);
+        inputObject["time"] = input.timestamp / 1e6;
+        inputObject["x"] = input.position.x();
+        inputObject["y"] = input.position.y();
+        inputObject["button"] = int(input.button);
+        inputObject["buttons"] = int(input.buttons);
+        inputArray.append(inputObject);
+    }
+
+    QJsonObject recordingObject;
+    recordingObject["canvasSize"] = recordedCanvasSize;
+    recordingObject["inputs"] = inputArray;
+
+    QFile file(recordingDir);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+    file.write(QJsonDocument(recordingObject).toJson());
+    inputs.clear();
+    return true;
+}
+
+/**
+ * @brief InputRecorder::eventFilter
+ * Records the mouse presses, drags, and releases that reach the canvas, then lets them through.
+ *
+ * @param watched -- the object receiving the event
+ * @param event -- the event
+ * @return false, so that the canvas always handles the event
+ */
+bool InputRecorder::eventFilter(QObject* watched, QEvent* event)
+{
+    if (recording && watched == canvas && (event->type() == QEvent::MouseButtonPress
+                                           || event->type() == QEvent::MouseMove
+                                           || event->type() == QEvent::MouseButtonRelease))
+    {
+        QMouseEvent* mouseEvent = static_cast<QMouseEvent*>(event);
+        inputs.append(RecordedInput{event->type(), clock.nsecsElapsed(), canvas->mapToFrame(mouseEvent->position()),
+                                    mouseEvent->button(), mouseEvent->buttons()});
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+/**
+ * @brief InputRecorder::read
+ * Reads a recording written by stop.
+ *
+ * @param fileDir -- the file directory to read from
+ * @param canvasSize -- set to the canvas size the input was recorded at
+ * @param inputs -- set to the recorded inputs, in order
+ * @return true if the file is a recording, false otherwise (in which case neither output is changed)
+ */
+bool InputRecorder::read(QString fileDir, int& canvasSize, QList<RecordedInput>& inputs)
+{
+    QFile file(fileDir);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QJsonObject recordingObject = QJsonDocument::fromJson(file.readAll()).object();
+    int readCanvasSize = recordingObject["canvasSize"].toInt();
+    if (readCanvasSize <= 0)
+        return false;
+
+    QList<RecordedInput> readInputs;
+    for (const QJsonValue& inputValue : recordingObject["inputs"].toArray())
+    {
+        QJsonObject inputObject = inputValue.toObject();
+        QEvent::Type type = inputTypeFromName(inputObject["type"].toString());
+        if (type == QEvent::None)
+            return false;
+
+        readInputs.append(RecordedInput{type, qint64(inputObject["time"].toDouble() * 1e6),
+                                        QPointF(inputObject["x"].toDouble(), inputObject["y"].toDouble()),
+                                        Qt::MouseButton(inputObject["button"].toInt()),
+                                        Qt::MouseButtons(inputObject["buttons"].toInt())});
+    }
+
+    canvasSize = readCanvasSize;
+    inputs = readInputs;
+    return true;
+}
+
+/**
+ * @brief InputRecorder::replay
+ * Sends recorded inputs to a canvas one at a time, as fast as they are handled. After each
+ * input, the work it queued is finished, then pending events are processed, so that the
+ * drawing and repaint it caused are part of its time, whatever the timing of other threads.
+ * Positions are scaled from the recorded canvas size to the model's. Strokes replay
+ * exactly; panning does not, since the canvas moves under the recorded positions.
+ *
+ * @param canvas -- the canvas to send the inputs to, which must be showing
+ * @param model -- the model shown on the canvas
+ * @param recordedCanvasSize -- the canvas size the inputs were recorded at
+ * @param inputs -- the inputs to replay
+ * @param finishInput -- finishes the work an input queued on other threads, such as drawing a stroke
+ * @return the time each input took, the number of canvas repaints, and the final frame hashes
+ */
+InputRecorder::ReplayReport InputRecorder::replay(CanvasWidget* canvas, SpriteEditorModel* model,
+                                                  int recordedCanvasSize, const QList<RecordedInput>& inputs,
+                                                  std::function<void()> finishInput)
+{
+    ReplayReport report;
+    report.repaintCount = 0;
+    QMetaObject::Connection repaintCounter = connect(canvas, &CanvasWidget::painted,
+                                                     canvas, [&report](){report.repaintCount++;});
+
+    // Let any pending layout and repaint settle, so that they aren't counted against the first input.
+    QCoreApplication::processEvents();
+
+    double scale = double(model->getCanvasSize()) / recordedCanvasSize;
+    QElapsedTimer inputTimer;
+    for (const RecordedInput& input : inputs)
+    {
+        QPointF position = canvas->mapFromFrame(input.position * scale);
+        QMouseEvent event(input.type, position, canvas->mapToGlobal(position),
+                          input.button, input.buttons, Qt::NoModifier);
+
+        inputTimer.start();
+        QCoreApplication::sendEvent(canvas, &event);
+        finishInput();
+        QCoreApplication::processEvents();
+        report.inputDurations.append(inputTimer.nsecsElapsed());
+    }
+
+    disconnect(repaintCounter);
+    for (int i = 0; i < model->getFrameCount(); i++)
+        report.frameHashes.append(model->getFrameHash(i));
+    return report;
+}
@@ -0,0 +1,85 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the class definition for the InputRecorder class.
+ */
+
+
+#ifndef INPUTRECORDER_H
+#define INPUTRECORDER_H
+
+#include "canvaswidget.h"
+#include "spriteeditormodel.h"
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QList>
+#include <QObject>
+#include <QPointF>
+#include <QString>
+#include <functional>
+
+
+/**
+ * @brief The InputRecorder class
+ * Records the mouse presses, drags, and releases that reach the canvas, with their
+ * timing, and replays recordings against a canvas for end-to-end latency measurements.
+ * Positions are kept in frame coordinates, so a recording replays at any zoom or pan,
+ * and scales to any canvas size. Recordings are written as JSON.
+ */
+class InputRecorder : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * A single recorded mouse event. The timestamp is in nanoseconds since recording began.
+     */
+    struct RecordedInput
+    {
+        QEvent::Type type;
+        qint64 timestamp;
+        QPointF position;
+        Qt::MouseButton button;
+        Qt::MouseButtons buttons;
+    };
+
+    /**
+     * What a replay measured: how long each input took to process, including the repaint
+     * it caused, how many times the canvas was painted, and the hash of every frame after.
+     */
+    struct ReplayReport
+    {
+        QList<qint64> inputDurations;
+        int repaintCount;
+        QList<size_t> frameHashes;
+    };
+
+    InputRecorder(CanvasWidget* canvas, SpriteEditorModel* model, QObject *parent = nullptr);
+
+    bool isRecording();
+    void start(QString);
+    bool stop();
+
+    static bool read(QString, int&, QList<RecordedInput>&);
+    static ReplayReport replay(CanvasWidget*, SpriteEditorModel*, int, const QList<RecordedInput>&,
+                               std::function<void()>);
+
+private:
+    CanvasWidget* canvas;
+    SpriteEditorModel* model;
+
+    bool recording = false;
+    QString recordingDir;
+    int recordedCanvasSize = 0;
+    QElapsedTimer clock;
+    QList<RecordedInput> inputs;
+
+    bool eventFilter(QObject*, QEvent*) override;
+};
+
+#endif // INPUTRECORDER_H
@@ -0,0 +1,117 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Connor Blood
+ *
+ * This file contains the class definition for the SpriteEditorModel class.
+ */
+
+
+#include "inputrecorder.h"
+#include "spriteeditorview.h"
+#include "tracer.h"
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+#include <algorithm>
+#include <numeric>
+
+
+/**
+ * @brief printReplayReport
+ * Prints the time each input took, a summary of those times, the number of canvas
+ * repaints, and the hash of every frame, so that replays can be compared run to run.
+ *
+ * @param inputs -- the replayed inputs
+ * @param report -- what the replay measured
+ */
+static void printReplayReport(const QList<InputRecorder::RecordedInput>& inputs, const InputRecorder::ReplayReport& report)
+{
+    QTextStream out(stdout);
+    for (int i = 0; i < inputs.count(); i++)
+    {
+        QString type = inputs[i].type == QEvent::MouseButtonPress ? "press"
+                     : inputs[i].type == QEvent::MouseButtonRelease ? "release" : "move";
+        out << QString("input %1  %2 %3 us\n").arg(i, 6).arg(type, -7).arg(report.inputDurations[i] / 1e3, 10, 'f', 1);
+    }
+
+    QList<qint64> sortedDurations = report.inputDurations;
+    std::sort(sortedDurations.begin(), sortedDurations.end());
+    qint64 totalDuration = std::accumulate(sortedDurations.begin(), sortedDurations.end(), qint64(0));
+    if (!sortedDurations.isEmpty())
+    {
+        out << QString("inputs           %1\n").arg(sortedDurations.count());
+        out << QString("total            %1 ms\n").arg(totalDuration / 1e6, 0, 'f', 2);
+        out << QString("mean             %1 us\n").arg(totalDuration / 1e3 / sortedDurations.count(), 0, 'f', 1);
+        out << QString("median           %1 us\n").arg(sortedDurations[sortedDurations.count() / 2] / 1e3, 0, 'f', 1);
+        out << QString("95th percentile  %1 us\n").arg(sortedDurations[sortedDurations.count() * 95 / 100] / 1e3, 0, 'f', 1);
+        out << QString("worst            %1 us\n").arg(sortedDurations.last() / 1e3, 0, 'f', 1);
+    }
+    out << QString("repaints         %1\n").arg(report.repaintCount);
+    for (int i = 0; i < report.frameHashes.count(); i++)
+        out << QString("frame %1 hash     %2\n").arg(i).arg(quint64(report.frameHashes[i]), 16, 16, QChar('0'));
+}
+
+/**
+ * @brief Application entry point
+ * Opens the editor, or with --replay, replays a canvas input recording headlessly and
+ * prints what it measured.
+ *
+ * @param argc -- the number of command line arguments
+ * @param argv -- the command line arguments
+ * @return exit state
+ */
+int main(int argc, char *argv[])
+{
+    // Replays never need a window on screen.
+    bool replaying = std::any_of(argv + 1, argv + argc, [](const char* argument){return qstrcmp(argument, "--replay") == 0;});
+    if (replaying && qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication a(argc, argv);
+    Tracer::instance().startFromEnvironment();
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption replayOption("replay", "Replays a canvas input recording headlessly.", "recording");
+    QCommandLineOption canvasSizeOption("canvas-size", "The canvas size to replay at (default: as recorded).", "size");
+    parser.addOption(replayOption);
+    parser.addOption(canvasSizeOption);
+    parser.process(a);
+
+    SpriteEditorModel model;
+    SpriteEditorView view(model);
+    view.show();
+
+    int exitState;
+    if (parser.isSet(replayOption))
+    {
+        int recordedCanvasSize;
+        QList<InputRecorder::RecordedInput> inputs;
+        if (!InputRecorder::read(parser.value(replayOption), recordedCanvasSize, inputs))
+        {
+            QTextStream(stderr) << "Could not read the input recording.\n";
+            return 1;
+        }
+
+        int canvasSize = parser.isSet(canvasSizeOption) ? parser.value(canvasSizeOption).toInt() : recordedCanvasSize;
+        if (canvasSize <= 0)
+            canvasSize = recordedCanvasSize;
+        model.newFile(canvasSize);
+
+        printReplayReport(inputs, InputRecorder::replay(view.findChild<CanvasWidget*>(), &model, recordedCanvasSize, inputs,
+                                                        [&view](){view.finishPendingStroke();}));
+        exitState = 0;
+    }
+    else
+    {
+        exitState = a.exec();
+    }
+
+    // Write out any trace that is still being recorded.
+    Tracer::instance().stop();
+    return exitState;
+}
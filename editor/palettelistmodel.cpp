@@ -0,0 +1,135 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the implementation of the class definition located in palettelistmodel.h.
+ */
+
+
+#include "palettelistmodel.h"
+#include <QPainter>
+
+
+/**
+ * @brief PaletteListModel::PaletteListModel
+ * Constructor. Creates a list model over the document palette of the given document,
+ * and keeps it in step with the palette as colors are used, picked, and removed.
+ *
+ * @param document -- the model whose palette to list
+ * @param swatchSize -- the width and height of each swatch, in pixels
+ * @param parent -- QObject parent object
+ */
+PaletteListModel::PaletteListModel(SpriteEditorModel* document, int swatchSize, QObject *parent)
+    : QAbstractListModel(parent)
+    , document{document}
+    , swatchSize{swatchSize}
+    , palette{document->getDocumentPalette()}
+{
+    connect(document, &SpriteEditorModel::documentPaletteChanged,
+            this, &PaletteListModel::updatePalette);
+}
+
+/**
+ * @brief PaletteListModel::rowCount
+ *
+ * @param parent -- unused, since the list is flat
+ * @return the number of colors in the palette
+ */
+int PaletteListModel::rowCount(const QModelIndex& parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return palette.count();
+}
+
+/**
+ * @brief PaletteListModel::data
+ * Returns the swatch or description of a palette color.
+ *
+ * @param index -- the index of the row
+ * @param role -- the role of the data to return
+ * @return the color's swatch for the decoration role, or its value and pixel count for the tooltip role
+ */
+QVariant PaletteListModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= palette.count())
+        return QVariant();
+
+    QRgb color = palette[index.row()];
+    qint64 pixelCount = document->getDocumentColors().getCount(color);
+
+    if (role == Qt::DecorationRole)
+        return drawSwatch(color, pixelCount > 0);
+    if (role == Qt::ToolTipRole)
+    {
+        QString name = QColor::fromRgba(color).name(QColor::HexArgb);
+        if (pixelCount == 0)
+            return QString("%1\nUnused").arg(name);
+        return QString("%1\n%2 pixel%3").arg(name).arg(pixelCount).arg(pixelCount == 1 ? "" : "s");
+    }
+    return QVariant();
+}
+
+/**
+ * @brief PaletteListModel::getColor
+ *
+ * @param index -- the index of a row
+ * @return the palette color of the row
+ */
+QRgb PaletteListModel::getColor(const QModelIndex& index) const
+{
+    return palette.at(index.row());
+}
+
+/**
+ * @brief PaletteListModel::drawSwatch
+ * Draws a square of a color, struck through if no pixel uses it.
+ *
+ * @param color -- the color of the swatch
+ * @param used -- whether any pixel uses the color
+ * @return the swatch
+ */
+QPixmap PaletteListModel::drawSwatch(QRgb color, bool used) const
+{
+    QPixmap swatch(swatchSize, swatchSize);
+    swatch.fill(QColor::fromRgba(color));
+    if (used)
+        return swatch;
+
+    QPainter painter(&swatch);
+    painter.setPen(QPen(Qt::red, 2));
+    painter.drawLine(0, swatchSize, swatchSize, 0);
+    return swatch;
+}
+
+/**
+ * @brief PaletteListModel::updatePalette
+ * Takes the latest palette from the document. Colors are almost always only added to the
+ * end of the palette, so new rows are inserted and the existing swatches are refreshed,
+ * since some of their colors may have become used or unused. Any other change resets the list.
+ */
+void PaletteListModel::updatePalette()
+{
+    QList<QRgb> newPalette = document->getDocumentPalette();
+    int oldCount = palette.count();
+    if (newPalette.count() < oldCount || newPalette.first(oldCount) != palette)
+    {
+        beginResetModel();
+        palette = newPalette;
+        endResetModel();
+        return;
+    }
+
+    if (oldCount > 0)
+        emit dataChanged(index(0), index(oldCount - 1), {Qt::DecorationRole, Qt::ToolTipRole});
+    if (newPalette.count() > oldCount)
+    {
+        beginInsertRows(QModelIndex(), oldCount, newPalette.count() - 1);
+        palette = newPalette;
+        endInsertRows();
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the PaletteListModel class.
+ */
+
+
+#ifndef PALETTELISTMODEL_H
+#define PALETTELISTMODEL_H
+
+#include "spriteeditormodel.h"
+#include <QAbstractListModel>
+#include <QPixmap>
+
+
+/**
+ * @brief The PaletteListModel class
+ * Exposes the document palette of a SpriteEditorModel to a list view, one row per color,
+ * with a swatch as its decoration. The tooltip of each swatch gives how many pixels use the
+ * color, and the swatches of unused colors are struck through. Counts are read from the
+ * document's color histogram when a row is shown, so they are never recounted here.
+ */
+class PaletteListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    PaletteListModel(SpriteEditorModel* document, int swatchSize, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    QRgb getColor(const QModelIndex&) const;
+
+private:
+    SpriteEditorModel* document;
+    int swatchSize;
+    QList<QRgb> palette;
+
+    QPixmap drawSwatch(QRgb, bool) const;
+
+public slots:
+    void updatePalette();
+};
+
+#endif // PALETTELISTMODEL_H
@@ -0,0 +1,174 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the implementation of the class definition located in performancehud.h.
+ */
+
+
+#include "performancehud.h"
+
+
+/**
+ * @brief PerformanceHud::PerformanceHud
+ * Constructor. Creates a hidden overlay that ignores the mouse, so that it never
+ * gets in the way of drawing.
+ *
+ * @param parent -- QWidget parent object
+ */
+PerformanceHud::PerformanceHud(QWidget *parent)
+    : QLabel(parent)
+{
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setStyleSheet("QLabel { background-color: rgba(0, 0, 0, 170); color: #32CD32; "
+                  "font-family: monospace; padding: 6px; border-radius: 4px; }");
+    hide();
+
+    clock.start();
+    refreshTimer.setInterval(REFRESH_INTERVAL);
+    connect(&refreshTimer, &QTimer::timeout,
+            this, &PerformanceHud::refresh);
+    refreshTimer.start();
+}
+
+/**
+ * @brief PerformanceHud::recordCanvasRepaint
+ * Records that the canvas was redrawn.
+ *
+ * @param duration -- how long the redraw took, in nanoseconds
+ */
+void PerformanceHud::recordCanvasRepaint(qint64 duration)
+{
+    lastRepaintDuration = duration;
+    repaintTimestamps.append(clock.elapsed());
+    pruneTimestamps(repaintTimestamps);
+}
+
+/**
+ * @brief PerformanceHud::recordPreviewFrame
+ * Records that the preview displayed a frame.
+ */
+void PerformanceHud::recordPreviewFrame()
+{
+    previewTimestamps.append(clock.elapsed());
+    pruneTimestamps(previewTimestamps);
+}
+
+/**
+ * @brief PerformanceHud::beginStroke
+ * Starts a new stroke, resetting its worst input-to-paint latency.
+ */
+void PerformanceHud::beginStroke()
+{
+    worstInputLatency = 0;
+    beginInput();
+}
+
+/**
+ * @brief PerformanceHud::beginInput
+ * Marks the arrival of an input event. The next canvas paint completes its latency.
+ */
+void PerformanceHud::beginInput()
+{
+    if (inputTimestamp < 0)
+        inputTimestamp = clock.nsecsElapsed();
+}
+
+/**
+ * @brief PerformanceHud::recordCanvasPainted
+ * Records that the canvas reached the screen, completing the latency of any pending input.
+ */
+void PerformanceHud::recordCanvasPainted()
+{
+    if (inputTimestamp < 0)
+        return;
+
+    lastInputLatency = clock.nsecsElapsed() - inputTimestamp;
+    worstInputLatency = qMax(worstInputLatency, lastInputLatency);
+    inputTimestamp = -1;
+}
+
+/**
+ * @brief PerformanceHud::setMemoryUsage
+ * Updates the memory figures shown.
+ *
+ * @param frames -- bytes held by the frames
+ * @param history -- bytes held by the undo/redo stacks
+ * @param caches -- bytes held by every cache, such as the frame thumbnails
+ * @param budget -- the memory budget in bytes, or 0 if there is none
+ */
+void PerformanceHud::setMemoryUsage(qint64 frames, qint64 history, qint64 caches, qint64 budget)
+{
+    frameBytes = frames;
+    historyBytes = history;
+    cacheBytes = caches;
+    budgetBytes = budget;
+}
+
+/**
+ * @brief PerformanceHud::pruneTimestamps
+ * Drops the timestamps that have fallen out of the window used to compute rates.
+ *
+ * @param timestamps -- the timestamps to prune, in milliseconds, oldest first
+ */
+void PerformanceHud::pruneTimestamps(QList<qint64>& timestamps)
+{
+    qint64 windowStart = clock.elapsed() - RATE_WINDOW;
+    while (!timestamps.isEmpty() && timestamps.first() < windowStart)
+        timestamps.removeFirst();
+}
+
+/**
+ * @brief PerformanceHud::formatBytes
+ *
+ * @param bytes -- a number of bytes
+ * @return the number of bytes in a human-readable unit
+ */
+QString PerformanceHud::formatBytes(qint64 bytes)
+{
+    if (bytes < 1024)
+        return QString("%1 B").arg(bytes);
+    if (bytes < 1024 * 1024)
+        return QString("%1 KB").arg(bytes / 1024.0, 0, 'f', 1);
+    return QString("%1 MB").arg(bytes / (1024.0 * 1024.0), 0, 'f', 1);
+}
+
+/**
+ * @brief PerformanceHud::refresh
+ * Redraws the overlay text, if the overlay is showing.
+ */
+void PerformanceHud::refresh()
+{
+    if (!isVisible())
+        return;
+
+    // Give the view a chance to report up-to-date memory figures.
+    emit aboutToRefresh();
+
+    pruneTimestamps(repaintTimestamps);
+    pruneTimestamps(previewTimestamps);
+
+    QString budget = "none";
+    if (budgetBytes > 0)
+        budget = QString("%1 of %2").arg(formatBytes(frameBytes + historyBytes + cacheBytes), formatBytes(budgetBytes));
+
+    setText(QString("Canvas repaint   %1 ms\n"
+                    "Repaints/sec     %2\n"
+                    "Preview FPS      %3\n"
+                    "Frames           %4\n"
+                    "Undo/redo        %5\n"
+                    "Caches           %6\n"
+                    "Budget           %7\n"
+                    "Input latency    %8 ms (worst %9 ms)")
+            .arg(lastRepaintDuration / 1e6, 0, 'f', 2)
+            .arg(repaintTimestamps.count())
+            .arg(previewTimestamps.count())
+            .arg(formatBytes(frameBytes), formatBytes(historyBytes), formatBytes(cacheBytes), budget)
+            .arg(lastInputLatency / 1e6, 0, 'f', 2)
+            .arg(worstInputLatency / 1e6, 0, 'f', 2));
+    adjustSize();
+}
@@ -0,0 +1,74 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   October 18, 2026
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the PerformanceHud class.
+ */
+
+
+#ifndef PERFORMANCEHUD_H
+#define PERFORMANCEHUD_H
+
+#include <QElapsedTimer>
+#include <QLabel>
+#include <QList>
+#include <QTimer>
+
+
+/**
+ * @brief The PerformanceHud class
+ * A translucent overlay showing live performance numbers for the editor window: how long
+ * canvas repaints take and how often they happen, the frame rate the preview actually
+ * achieves, how much memory the document and its caches hold against the memory budget,
+ * and the input-to-paint latency of the current stroke. The view feeds it measurements;
+ * it redraws its text twice a second.
+ */
+class PerformanceHud : public QLabel
+{
+    Q_OBJECT
+
+public:
+    explicit PerformanceHud(QWidget *parent = nullptr);
+
+    void recordCanvasRepaint(qint64);
+    void recordPreviewFrame();
+    void beginStroke();
+    void beginInput();
+    void recordCanvasPainted();
+    void setMemoryUsage(qint64, qint64, qint64, qint64);
+
+private:
+    const int REFRESH_INTERVAL = 500;
+    const int RATE_WINDOW = 1000;
+
+    QTimer refreshTimer;
+    QElapsedTimer clock;
+
+    QList<qint64> repaintTimestamps;
+    qint64 lastRepaintDuration = 0;
+    QList<qint64> previewTimestamps;
+
+    qint64 inputTimestamp = -1;
+    qint64 lastInputLatency = 0;
+    qint64 worstInputLatency = 0;
+
+    qint64 frameBytes = 0;
+    qint64 historyBytes = 0;
+    qint64 cacheBytes = 0;
+    qint64 budgetBytes = 0;
+
+    void pruneTimestamps(QList<qint64>&);
+    static QString formatBytes(qint64);
+
+private slots:
+    void refresh();
+
+signals:
+    void aboutToRefresh();
+};
+
+#endif // PERFORMANCEHUD_H
@@ -0,0 +1,1223 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   April 5, 2023
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the implementation of the class definition located in spriteeditorview.h.
+ */
+
+
+#include "spriteeditorview.h"
+#include "ui_spriteeditorview.h"
+#include "framethumbnaildelegate.h"
+#include "tracer.h"
+#include <QClipboard>
+#include <QColorDialog>
+#include <QFileInfo>
+#include <QGuiApplication>
+#include <QMessageBox>
+
+
+/**
+ * @brief SpriteEditorView::SpriteEditorView
+ * Constructor. Creates a new SpriteEditorView object, sets up the ui,
+ * and establishes connections between different classes and the model.
+ *
+ * @param parent -- QWidget parent object
+ */
+SpriteEditorView::SpriteEditorView(SpriteEditorModel& modelParam, QWidget* parent)
+    : QMainWindow(parent)
+    , model{&modelParam}
+    , ui(new Ui::SpriteEditorView)
+    , undoShortcut(QKeySequence(Qt::CTRL | Qt::Key_Z), this)
+    , redoShortcut(QKeySequence(Qt::CTRL | Qt::Key_Y), this)
+    , newShortcut(QKeySequence(Qt::CTRL | Qt::Key_N), this)
+    , openShortcut(QKeySequence(Qt::CTRL | Qt::Key_O), this)
+    , saveShortcut(QKeySequence(Qt::CTRL | Qt::Key_S), this)
+    , saveAsShortcut(QKeySequence(Qt::CTRL | Qt::SHIFT | Qt::Key_S), this)
+{
+    ui->setupUi(this);
+    this->setWindowTitle("Sprite Editor");
+    ui->animationStartButton->setStyleSheet("QPushButton {color: #32CD32};");
+    ui->penButton->setEnabled(false);
+
+    // Connections for managing the color palette.
+    connect(ui->colorPicker, &ColorPicker::updateNewColor,
+            model, &SpriteEditorModel::updateRecentColorsList);
+    connect(model, &SpriteEditorModel::updateRecentColors,
+            ui->colorPicker, &ColorPicker::drawRecentColors);
+    connect(model, &SpriteEditorModel::resetColorPalette,
+            ui->colorPicker, &ColorPicker::resetColorPalette);
+
+    // Set up the document palette, docked beside the drawing tools. Swatches share one size,
+    // so only the visible ones are laid out, however many colors the sprite uses.
+    paletteListModel = new PaletteListModel(model, SWATCH_SIZE, this);
+    QListView* paletteList = new QListView;
+    paletteList->setModel(paletteListModel);
+    paletteList->setViewMode(QListView::IconMode);
+    paletteList->setMovement(QListView::Static);
+    paletteList->setResizeMode(QListView::Adjust);
+    paletteList->setUniformItemSizes(true);
+    paletteList->setIconSize(QSize(SWATCH_SIZE, SWATCH_SIZE));
+    paletteDock = new QDockWidget("Document Palette", this);
+    paletteDock->setWidget(paletteList);
+    addDockWidget(Qt::RightDockWidgetArea, paletteDock);
+    ui->menuView->addAction(paletteDock->toggleViewAction());
+    connect(paletteList, &QListView::clicked,
+            this, &SpriteEditorView::paletteColorClicked);
+    connect(ui->actionRemoveUnusedColors, &QAction::triggered,
+            model, &SpriteEditorModel::removeUnusedColors);
+
+    // Connections for managing brushes.
+    connect(ui->colorPicker, &ColorPicker::updateNewColor,
+            this, &SpriteEditorView::onPenClick);
+    connect(ui->penButton, &QPushButton::clicked,
+            this, &SpriteEditorView::onPenClick);
+    connect(ui->eraserButton, &QPushButton::clicked,
+            this, &SpriteEditorView::onEraserClick);
+
+    // Set up the frame list. Rows share one size, so only the visible thumbnails are ever laid out or drawn.
+    frameListModel = new FrameListModel(model, THUMBNAIL_SIZE, this);
+    ui->frameList->setModel(frameListModel);
+    ui->frameList->setItemDelegate(new FrameThumbnailDelegate(THUMBNAIL_SIZE, ui->frameList));
+    ui->frameList->setUniformItemSizes(true);
+    ui->frameList->setSelectionMode(QAbstractItemView::ExtendedSelection);
+
+    // Connections for managing saved data (new, open, save, save as).
+    connect(model, &SpriteEditorModel::canvasSizeChanged,
+            ui->canvas, &CanvasWidget::zoomToFit);
+    connect(ui->actionNew, &QAction::triggered,
+            this, &SpriteEditorView::newClicked);
+    connect(&newShortcut, &QShortcut::activated,
+            this, &SpriteEditorView::newClicked);
+    connect(ui->actionOpen, &QAction::triggered,
+            this, &SpriteEditorView::openClicked);
+    connect(&openShortcut, &QShortcut::activated,
+            this, &SpriteEditorView::openClicked);
+    connect(ui->actionSave, &QAction::triggered,
+            model, &SpriteEditorModel::saveClicked);
+    connect(&saveShortcut, &QShortcut::activated,
+            model, &SpriteEditorModel::saveClicked);
+    connect(model, &SpriteEditorModel::noSaveDirectory,
+            this, &SpriteEditorView::saveAsClicked);
+    connect(ui->actionSaveAs, &QAction::triggered,
+            this, &SpriteEditorView::saveAsClicked);
+    connect(&saveAsShortcut, &QShortcut::activated,
+            this, &SpriteEditorView::saveAsClicked);
+    connect(ui->actionExportSpriteSheet, &QAction::triggered,
+            this, &SpriteEditorView::exportSpriteSheetClicked);
+    connect(ui->actionExportGif, &QAction::triggered,
+            this, [this](){exportAnimationClicked(SpriteEditorModel::GIF);});
+    connect(ui->actionExportApng, &QAction::triggered,
+            this, [this](){exportAnimationClicked(SpriteEditorModel::APNG);});
+    connect(model, &SpriteEditorModel::animationExportProgress,
+            this, &SpriteEditorView::showAnimationExportProgress);
+    connect(model, &SpriteEditorModel::animationExportFinished,
+            this, &SpriteEditorView::showAnimationExportResult);
+
+    // Files are opened and saved in the background. The progress dialog doesn't block the
+    // window, and only appears if the operation takes long enough to notice.
+    fileProgressDialog = new QProgressDialog(this);
+    fileProgressDialog->setWindowTitle("Sprite Editor");
+    fileProgressDialog->setMinimumDuration(FILE_PROGRESS_DELAY);
+    fileProgressDialog->setAutoReset(false);
+    fileProgressDialog->reset();
+    connect(fileProgressDialog, &QProgressDialog::canceled,
+            model, &SpriteEditorModel::cancelFileOperation);
+    connect(model, &SpriteEditorModel::fileOperationStarted,
+            this, &SpriteEditorView::showFileOperationStarted);
+    connect(model, &SpriteEditorModel::fileOperationProgress,
+            this, &SpriteEditorView::showFileOperationProgress);
+    connect(model, &SpriteEditorModel::fileOperationFinished,
+            this, &SpriteEditorView::showFileOperationResult);
+    connect(model, &SpriteEditorModel::frameLoadingChanged,
+            this, &SpriteEditorView::showFrameLoading);
+
+    // Connections for managing frames (add, clear, duplicate, etc.)
+    connect(ui->addFrame, &QPushButton::clicked,
+            model, &SpriteEditorModel::createNewFrame);
+    connect(model, &SpriteEditorModel::setUpNewFrame,
+            this, &SpriteEditorView::setUpNewFrame);
+    connect(ui->clearFrame, &QPushButton::clicked,
+            this, &SpriteEditorView::warnAboutClearFrame);
+    connect(model, &SpriteEditorModel::warnAboutDeletion,
+            this, &SpriteEditorView::warnAboutDeletion);
+    connect(ui->deleteFrame, &QPushButton::clicked,
+            model, &SpriteEditorModel::deleteCurrentFrame);
+    connect(ui->duplicateFrame, &QPushButton::clicked,
+            model, &SpriteEditorModel::duplicateCurrentFrame);
+    connect(model, &SpriteEditorModel::setFocusToIndex,
+            this, &SpriteEditorView::focusFrame);
+    connect(model, &SpriteEditorModel::frameUpdated,
+            this, &SpriteEditorView::refreshFrame);
+    connect(model, &SpriteEditorModel::framesInserted,
+            this, [this](){ui->frameList->setCurrentIndex(frameListModel->index(model->getCurrentFrameIndex()));});
+    connect(ui->frameList, &QListView::clicked,
+            this, [this](const QModelIndex& index){model->selectFrame(index.row());});
+    connect(ui->actionFlipHorizontal, &QAction::triggered,
+            this, [this](){model->flipFrames(getSelectedFrameIndices(), Qt::Horizontal);});
+    connect(ui->actionFlipVertical, &QAction::triggered,
+            this, [this](){model->flipFrames(getSelectedFrameIndices(), Qt::Vertical);});
+    connect(ui->actionRotateClockwise, &QAction::triggered,
+            this, [this](){model->rotateFrames(getSelectedFrameIndices(), true);});
+    connect(ui->actionRotateCounterclockwise, &QAction::triggered,
+            this, [this](){model->rotateFrames(getSelectedFrameIndices(), false);});
+    connect(ui->actionShiftFrames, &QAction::triggered,
+            this, &SpriteEditorView::shiftFramesClicked);
+    connect(ui->actionSwapPalette, &QAction::triggered,
+            this, &SpriteEditorView::swapPaletteClicked);
+    connect(ui->actionReplaceColorEverywhere, &QAction::triggered,
+            this, &SpriteEditorView::replaceColorEverywhereClicked);
+    connect(ui->actionReduceColors, &QAction::triggered,
+            this, &SpriteEditorView::reduceColorsClicked);
+    connect(ui->actionOutlineFrames, &QAction::triggered,
+            this, [this](){model->outlineFrames(getSelectedFrameIndices(), model->getCurrentColor());});
+    connect(ui->actionSetFrameDuration, &QAction::triggered,
+            this, &SpriteEditorView::setFrameDurationClicked);
+    connect(ui->actionImportImageSequence, &QAction::triggered,
+            this, &SpriteEditorView::importImageSequenceClicked);
+    connect(ui->actionImportSpriteSheet, &QAction::triggered,
+            this, &SpriteEditorView::importSpriteSheetClicked);
+
+    // Connections for managing the preview frame
+    connect(model, &SpriteEditorModel::displayPreviewFrame,
+            this, &SpriteEditorView::displayPreviewFrame);
+    connect(model, &SpriteEditorModel::resetPreview,
+            this, &SpriteEditorView::resetPreview);
+    connect(ui->animationStartButton, &QPushButton::clicked,
+            model, &SpriteEditorModel::toggleAnimation);
+    connect(model, &SpriteEditorModel::animationStarted,
+            this, [this](){ui->animationStartButton->setText(QString("■"));
+                           ui->animationStartButton->setStyleSheet("QPushButton {color: red};");});
+    connect(model, &SpriteEditorModel::animationStopped,
+            this, [this](){ui->animationStartButton->setText(QString("▶"));
+                           ui->animationStartButton->setStyleSheet("QPushButton {color: #32CD32};");});
+    connect(ui->fpsSlider, &QSlider::valueChanged,
+            model, &SpriteEditorModel::changeAnimationSpeed);
+
+    // Connections for managing edits (undo, redo)
+    connect(ui->actionUndo, &QAction::triggered,
+            model, &SpriteEditorModel::undo);
+    connect(ui->actionRedo, &QAction::triggered,
+            model, &SpriteEditorModel::redo);
+    connect(&undoShortcut, &QShortcut::activated,
+            model, &SpriteEditorModel::undo);
+    connect(&redoShortcut, &QShortcut::activated,
+            model, &SpriteEditorModel::redo);
+
+    // Connections for selecting, and for the clipboard
+    connect(ui->actionRectangleSelect, &QAction::triggered,
+            this, [this](){onSelectToolClick(SpriteEditorModel::RECTANGLE_SELECT);});
+    connect(ui->actionMagicWand, &QAction::triggered,
+            this, [this](){onSelectToolClick(SpriteEditorModel::MAGIC_WAND);});
+    connect(ui->actionSelectAll, &QAction::triggered,
+            model, &SpriteEditorModel::selectAll);
+    connect(ui->actionDeselect, &QAction::triggered,
+            model, &SpriteEditorModel::clearSelection);
+    connect(ui->actionPlaceSelection, &QAction::triggered,
+            model, &SpriteEditorModel::commitSelection);
+    connect(ui->actionDeleteSelection, &QAction::triggered,
+            model, &SpriteEditorModel::deleteSelection);
+    connect(ui->actionCut, &QAction::triggered,
+            this, &SpriteEditorView::cutClicked);
+    connect(ui->actionCopy, &QAction::triggered,
+            this, &SpriteEditorView::copyClicked);
+    connect(ui->actionPaste, &QAction::triggered,
+            this, &SpriteEditorView::pasteClicked);
+
+    // Connections for drawing on and navigating the canvas. Strokes are drawn on a worker thread,
+    // and swapped into the frame whenever the worker has finished a batch of them.
+    ui->canvas->setModel(model);
+    strokeRenderer = new StrokeRenderer(this);
+    connect(strokeRenderer, &StrokeRenderer::batchReady,
+            this, &SpriteEditorView::swapInStroke);
+    connect(ui->canvas, &CanvasWidget::pixelPressed,
+            this, &SpriteEditorView::canvasPressed);
+    connect(ui->canvas, &CanvasWidget::pixelDragged,
+            this, &SpriteEditorView::canvasDragged);
+    connect(ui->canvas, &CanvasWidget::strokeReleased,
+            this, &SpriteEditorView::canvasReleased);
+    connect(ui->canvas, &CanvasWidget::zoomChanged,
+            this, [this](double zoom){ui->statusbar->showMessage(QString("Zoom: %1%").arg(qRound(zoom * 100)), 2000);});
+    connect(ui->actionShowPixelGrid, &QAction::toggled,
+            ui->canvas, &CanvasWidget::setGridVisible);
+    connect(ui->actionZoomToFit, &QAction::triggered,
+            ui->canvas, &CanvasWidget::zoomToFit);
+
+    // Set up the performance HUD, which is told whenever the canvas paints, to time input-to-paint latency.
+    performanceHud = new PerformanceHud(ui->centralwidget);
+    performanceHud->move(10, 10);
+    connect(ui->canvas, &CanvasWidget::painted,
+            this, [this](qint64 duration){performanceHud->recordCanvasRepaint(duration);
+                                          performanceHud->recordCanvasPainted();});
+    connect(ui->actionShowPerformanceHud, &QAction::toggled,
+            this, [this](bool checked){performanceHud->setVisible(checked); performanceHud->raise();});
+    connect(performanceHud, &PerformanceHud::aboutToRefresh,
+            this, &SpriteEditorView::updatePerformanceHudMemory);
+
+    // Report the editor's caches to the model, which empties them when it goes over its memory budget.
+    model->addCacheReporter(frameListModel, "Thumbnails",
+                            [this](){return frameListModel->getThumbnailByteCount();},
+                            [this](){frameListModel->clearThumbnails();});
+    model->addCacheReporter(ui->canvas, "Pixel grid",
+                            [this](){return ui->canvas->getGridByteCount();},
+                            [this](){ui->canvas->invalidateGrid();});
+    model->addCacheReporter(ui->colorPicker, "Color squares",
+                            [this](){return ui->colorPicker->getGradientByteCount();},
+                            [this](){ui->colorPicker->clearGradients();});
+    connect(model, &SpriteEditorModel::memoryBudgetExceeded,
+            this, &SpriteEditorView::reportMemoryBudgetExceeded);
+    connect(ui->actionSetMemoryBudget, &QAction::triggered,
+            this, &SpriteEditorView::setMemoryBudgetClicked);
+
+    // Connections for performance tracing and recording canvas input for replay
+    ui->actionRecordTrace->setChecked(Tracer::instance().isEnabled());
+    connect(ui->actionRecordTrace, &QAction::toggled,
+            this, &SpriteEditorView::recordTraceToggled);
+    inputRecorder = new InputRecorder(ui->canvas, model, this);
+    connect(ui->actionRecordInput, &QAction::toggled,
+            this, &SpriteEditorView::recordInputToggled);
+
+    setCanvasBackground(ui->previewBackground);
+
+    // Initialize a first frame
+    model->createNewFrame();
+
+    // Initialize the preview frame
+    QImage scaledCanvas = model->getFrame(model->getCurrentFrameIndex())
+                              ->scaledToWidth(ui->previewLabel->width(), Qt::FastTransformation);
+    ui->previewLabel->setPixmap(QPixmap::fromImage(scaledCanvas));
+}
+
+/**
+ * @brief SpriteEditorView::~SpriteEditorView
+ * Destructor. Deallocates memory for the ui object, and destructs this View.
+ */
+SpriteEditorView::~SpriteEditorView()
+{
+    delete ui;
+}
+
+
+// ===================================================
+// ===              FILE MANIPULATION              ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorView::saveAsClicked
+ * Prompts the user to choose a save location and format. If the save location is valid,
+ * start saving the file in the background, adding the format's extension if it is missing.
+ */
+void SpriteEditorView::saveAsClicked()
+{
+    QString compressedFilter = "Compressed SSP files (*.sspz)";
+    QString selectedFilter;
+    QString fileName = QFileDialog::getSaveFileName(
+                this, "Save As", QDir::homePath(), "SSP files (*.ssp);;" + compressedFilter, &selectedFilter);
+    if (fileName.isEmpty())
+        return;
+
+    QString extension = selectedFilter == compressedFilter ? ".sspz" : ".ssp";
+    if (!fileName.endsWith(extension))
+        fileName += extension;
+    if (!model->saveFileAsync(fileName))
+        ui->statusbar->showMessage("Another file is still being opened or saved.", 5000);
+}
+
+/**
+ * @brief SpriteEditorView::openClicked
+ * Prompts the user to choose a file. If the file is valid, start opening it in the
+ * background; the current sprite stays open until it has been read.
+ */
+void SpriteEditorView::openClicked()
+{
+    QString fileName = QFileDialog::getOpenFileName(
+                this, "Open", QDir::homePath(), "SSP files (*.ssp *.sspz)");
+    if (!fileName.isEmpty() && !model->openFileAsync(fileName))
+        ui->statusbar->showMessage("Another file is still being opened or saved.", 5000);
+}
+
+/**
+ * @brief SpriteEditorView::newClicked
+ * Prompts the user to choose a canvas size between 1 and 4096 pixels. Attempt to
+ * create a new file if the user clicks "ok". A file still being opened is cancelled.
+ */
+void SpriteEditorView::newClicked()
+{
+    bool ok;
+    int newCanvasSize = QInputDialog::getInt(
+                this, "Sprite Editor", "Enter a canvas size 1 - 4096:", 16, 1, MAX_CANVAS_SIZE, 1, &ok);
+    if (!ok)
+        return;
+
+    if (openingFile && model->isFileOperationRunning())
+        fileProgressDialog->cancel();
+    model->newFile(newCanvasSize);
+}
+
+
+/**
+ * @brief SpriteEditorView::exportSpriteSheetClicked
+ * Prompts the user to choose an export location. If the location is valid, attempt to export
+ * the frames as a packed sprite sheet, warning the user if the export fails.
+ */
+void SpriteEditorView::exportSpriteSheetClicked()
+{
+    QString fileName = QFileDialog::getSaveFileName(
+                this, "Export Sprite Sheet", QDir::homePath(), "PNG files (*.png)");
+    if (fileName.isEmpty())
+        return;
+
+    if (!fileName.endsWith(".png", Qt::CaseInsensitive))
+        fileName += ".png";
+
+    if (!model->exportSpriteSheet(fileName))
+    {
+        QMessageBox msgbox;
+        msgbox.setWindowTitle("WARNING");
+        msgbox.setIcon(QMessageBox::Warning);
+        msgbox.setText("Warning! The sprite sheet could not be exported.");
+        msgbox.setStandardButtons(QMessageBox::Cancel);
+        msgbox.setDefaultButton(QMessageBox::Cancel);
+        msgbox.exec();
+    }
+}
+
+/**
+ * @brief SpriteEditorView::exportAnimationClicked
+ * Prompts the user to choose an export location. If the location is valid, start exporting
+ * the animation in the given format. The export runs in the background, one at a time.
+ *
+ * @param format -- the animated image format to export
+ */
+void SpriteEditorView::exportAnimationClicked(SpriteEditorModel::AnimationFormat format)
+{
+    QString extension = format == SpriteEditorModel::GIF ? ".gif" : ".png";
+    QString filter = format == SpriteEditorModel::GIF ? "GIF files (*.gif)" : "APNG files (*.png)";
+
+    QString fileName = QFileDialog::getSaveFileName(
+                this, "Export Animation", QDir::homePath(), filter);
+    if (fileName.isEmpty())
+        return;
+
+    if (!fileName.endsWith(extension, Qt::CaseInsensitive))
+        fileName += extension;
+
+    if (model->exportAnimation(fileName, format))
+        ui->statusbar->showMessage("Exporting animation...");
+    else if (model->isLoadingFrames())
+        ui->statusbar->showMessage("The animation can't be exported until the file has been opened.", 5000);
+    else
+        ui->statusbar->showMessage("Another animation is still being exported.", 5000);
+}
+
+/**
+ * @brief SpriteEditorView::showAnimationExportProgress
+ * Shows how far along a background animation export is in the status bar.
+ *
+ * @param framesEncoded -- the number of frames encoded so far
+ * @param frameCount -- the total number of frames to encode
+ */
+void SpriteEditorView::showAnimationExportProgress(int framesEncoded, int frameCount)
+{
+    ui->statusbar->showMessage(QString("Exporting animation... frame %1 of %2").arg(framesEncoded).arg(frameCount));
+}
+
+/**
+ * @brief SpriteEditorView::showAnimationExportResult
+ * Reports the outcome of a background animation export in the status bar.
+ *
+ * @param success -- whether the animation was written successfully
+ */
+void SpriteEditorView::showAnimationExportResult(bool success)
+{
+    if (success)
+        ui->statusbar->showMessage("Animation exported.", 5000);
+    else
+        ui->statusbar->showMessage("The animation could not be exported.", 5000);
+}
+
+/**
+ * @brief SpriteEditorView::showFileOperationStarted
+ * Prepares the progress dialog for a file being opened or saved in the background.
+ *
+ * @param fileDir -- the file directory being opened or saved
+ * @param opening -- true if the file is being opened, false if it is being saved
+ */
+void SpriteEditorView::showFileOperationStarted(QString fileDir, bool opening)
+{
+    openingFile = opening;
+    QString fileName = QFileInfo(fileDir).fileName();
+    fileProgressDialog->setLabelText(opening ? "Opening " + fileName + "..." : "Saving " + fileName + "...");
+    fileProgressDialog->setValue(0);
+}
+
+/**
+ * @brief SpriteEditorView::showFileOperationProgress
+ * Shows how far along the file being opened or saved is.
+ *
+ * @param percent -- the percentage of the file processed so far
+ */
+void SpriteEditorView::showFileOperationProgress(int percent)
+{
+    if (!fileProgressDialog->wasCanceled())
+        fileProgressDialog->setValue(percent);
+}
+
+/**
+ * @brief SpriteEditorView::showFileOperationResult
+ * Closes the progress dialog and reports the outcome of a background open or save in the status bar.
+ *
+ * @param success -- whether the file was opened or saved whole
+ */
+void SpriteEditorView::showFileOperationResult(bool success)
+{
+    bool cancelled = fileProgressDialog->wasCanceled();
+    fileProgressDialog->reset();
+
+    if (success)
+        ui->statusbar->showMessage(openingFile ? "File opened." : "File saved.", 5000);
+    else if (cancelled)
+        ui->statusbar->showMessage(openingFile ? "Opening cancelled." : "Saving cancelled.", 5000);
+    else if (openingFile)
+        ui->statusbar->showMessage("The file could not be opened.", 5000);
+    else
+        ui->statusbar->showMessage("The file could not be saved.", 5000);
+}
+
+/**
+ * @brief SpriteEditorView::showFrameLoading
+ * Disables everything that adds, removes, or changes every frame while a file's frames are
+ * still being read, and enables it again once they all have been. The frames read so far
+ * can still be drawn on.
+ *
+ * @param loading -- true while some frames are still being read
+ */
+void SpriteEditorView::showFrameLoading(bool loading)
+{
+    for (QPushButton* button : {ui->addFrame, ui->deleteFrame, ui->duplicateFrame})
+        button->setEnabled(!loading);
+    for (QAction* action : {ui->actionSave, ui->actionSaveAs, ui->actionExportSpriteSheet, ui->actionExportGif,
+                            ui->actionExportApng, ui->actionImportImageSequence, ui->actionImportSpriteSheet,
+                            ui->actionFlipHorizontal, ui->actionFlipVertical, ui->actionRotateClockwise,
+                            ui->actionRotateCounterclockwise, ui->actionShiftFrames, ui->actionSwapPalette,
+                            ui->actionReplaceColorEverywhere, ui->actionReduceColors, ui->actionOutlineFrames,
+                            ui->actionSetFrameDuration})
+        action->setEnabled(!loading);
+    saveShortcut.setEnabled(!loading);
+    saveAsShortcut.setEnabled(!loading);
+}
+
+/**
+ * @brief SpriteEditorView::importImageSequenceClicked
+ * Prompts the user to choose a sequence of images, and imports them as new frames.
+ */
+void SpriteEditorView::importImageSequenceClicked()
+{
+    QStringList fileNames = QFileDialog::getOpenFileNames(
+                this, "Import Image Sequence", QDir::homePath(), "Image files (*.png *.bmp *.gif *.jpg)");
+    if (fileNames.isEmpty())
+        return;
+
+    int framesImported = model->importImageSequence(fileNames);
+    ui->statusbar->showMessage(QString("Imported %1 frames.").arg(framesImported), 5000);
+}
+
+/**
+ * @brief SpriteEditorView::importSpriteSheetClicked
+ * Prompts the user to choose a sprite sheet and the size of its cells, and imports each
+ * cell as a new frame.
+ */
+void SpriteEditorView::importSpriteSheetClicked()
+{
+    QString fileName = QFileDialog::getOpenFileName(
+                this, "Import Sprite Sheet", QDir::homePath(), "Image files (*.png *.bmp *.gif *.jpg)");
+    if (fileName.isEmpty())
+        return;
+
+    bool ok;
+    int cellSize = QInputDialog::getInt(
+                this, "Sprite Editor", "Enter the cell size of the sprite sheet:", model->getCanvasSize(), 1, 4096, 1, &ok);
+    if (!ok)
+        return;
+
+    int framesImported = model->importSpriteSheet(fileName, cellSize);
+    if (framesImported < 0)
+        ui->statusbar->showMessage(QString("The sprite sheet has more than %1 cells of that size; try a larger cell size.")
+                                       .arg(SpriteEditorModel::MAX_SPRITE_SHEET_CELLS), 5000);
+    else
+        ui->statusbar->showMessage(QString("Imported %1 frames.").arg(framesImported), 5000);
+}
+
+/**
+ * @brief SpriteEditorView::recordTraceToggled
+ * Starts or stops recording a performance trace. When recording starts, the user is prompted
+ * for where to write the trace; it is written once recording stops.
+ *
+ * @param checked -- whether recording was turned on
+ */
+void SpriteEditorView::recordTraceToggled(bool checked)
+{
+    if (!checked)
+    {
+        if (Tracer::instance().stop())
+            ui->statusbar->showMessage("Performance trace written.", 5000);
+        return;
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(
+                this, "Record Performance Trace", QDir::homePath(), "Trace files (*.json)");
+    if (fileName.isEmpty())
+    {
+        ui->actionRecordTrace->setChecked(false);
+        return;
+    }
+
+    if (!fileName.endsWith(".json", Qt::CaseInsensitive))
+        fileName += ".json";
+
+    Tracer::instance().start(fileName);
+    ui->statusbar->showMessage("Recording performance trace...");
+}
+
+/**
+ * @brief SpriteEditorView::recordInputToggled
+ * Starts or stops recording the mouse input on the canvas, for replay with --replay. When
+ * recording starts, the user is prompted for where to write the recording; it is written
+ * once recording stops.
+ *
+ * @param checked -- whether recording was turned on
+ */
+void SpriteEditorView::recordInputToggled(bool checked)
+{
+    if (!checked)
+    {
+        if (inputRecorder->stop())
+            ui->statusbar->showMessage("Input recording written.", 5000);
+        return;
+    }
+
+    QString fileName = QFileDialog::getSaveFileName(
+                this, "Record Canvas Input", QDir::homePath(), "Input recordings (*.json)");
+    if (fileName.isEmpty())
+    {
+        ui->actionRecordInput->setChecked(false);
+        return;
+    }
+
+    if (!fileName.endsWith(".json", Qt::CaseInsensitive))
+        fileName += ".json";
+
+    inputRecorder->start(fileName);
+    ui->statusbar->showMessage("Recording canvas input...");
+}
+
+// ===================================================
+// ===                   DRAWING                   ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorView::swapInStroke
+ * Swaps the frames the stroke renderer has finished into the document, whole, in place of
+ * the frames the stroke is drawn on. No pixel is copied here; the edit records the painted
+ * region of each frame once the stroke ends.
+ */
+void SpriteEditorView::swapInStroke()
+{
+    TRACE_SCOPE("swapInStroke");
+
+    StrokeRenderer::RenderedBatch batch = strokeRenderer->takeRenderedBatch();
+    if (batch.frames.isEmpty())
+        return;
+
+    // The edit lists its frames in the order the stroke was begun on them.
+    QList<int> strokeFrameIndices = model->getEditFrameIndices();
+    for (auto frame = batch.frames.cbegin(); frame != batch.frames.cend(); ++frame)
+    {
+        int frameIndex = strokeFrameIndices.at(frame.key());
+        model->replaceEditFrame(frameIndex, frame.value(), batch.dirtyRect);
+        frameListModel->updateFrame(frameIndex);
+    }
+
+    // Only the changed region of the canvas needs repainting.
+    ui->canvas->updatePixels(batch.dirtyRect);
+}
+
+/**
+ * @brief SpriteEditorView::canvasPressed
+ * On a left click on the canvas, an edit begins and the pixel under the cursor is drawn.
+ * With a selection tool, a click inside the selection starts moving it; anywhere else,
+ * it starts a new selection.
+ *
+ * @param pixel -- the frame coordinates of the clicked pixel
+ */
+void SpriteEditorView::canvasPressed(QPoint pixel)
+{
+    performanceHud->beginStroke();
+
+    SpriteEditorModel::Tool tool = model->getTool();
+    if (tool == SpriteEditorModel::RECTANGLE_SELECT || tool == SpriteEditorModel::MAGIC_WAND)
+    {
+        if (model->getSelectionRect().contains(pixel))
+        {
+            // Keep the selection at the same offset from the cursor while it moves.
+            movingSelection = true;
+            selectionAnchor = pixel - model->getSelectionRect().topLeft();
+        }
+        else if (tool == SpriteEditorModel::MAGIC_WAND)
+        {
+            model->selectSimilar(pixel);
+        }
+        else
+        {
+            selectingRect = true;
+            selectionAnchor = pixel;
+            model->selectRect(QRect(pixel, pixel));
+        }
+        return;
+    }
+
+    // When painting on selected frames, every selected frame gets the same stroke, as one edit.
+    model->beginEdit(ui->actionPaintSelectedFrames->isChecked() ? getSelectedFrameIndices() : QList<int>());
+    toggleDraw = true;
+
+    QList<QImage> strokeFrames;
+    for (int frameIndex : model->getEditFrameIndices())
+        strokeFrames.append(*model->getFrame(frameIndex));
+    strokeRenderer->beginStroke(strokeFrames);
+    strokeRenderer->addPixel(pixel, model->getCurrentColor().rgba());
+}
+
+/**
+ * @brief SpriteEditorView::canvasDragged
+ * On a drag across the canvas, the pixel under the cursor is queued for drawing if an edit is in progress.
+ * Otherwise, the selection being moved follows the cursor, or the rectangle being
+ * selected stretches to it.
+ *
+ * @param pixel -- the frame coordinates of the pixel under the cursor
+ */
+void SpriteEditorView::canvasDragged(QPoint pixel)
+{
+    if (toggleDraw)
+    {
+        performanceHud->beginInput();
+        strokeRenderer->addPixel(pixel, model->getCurrentColor().rgba());
+    }
+    else if (movingSelection)
+    {
+        performanceHud->beginInput();
+        model->moveSelection(pixel - selectionAnchor);
+    }
+    else if (selectingRect)
+    {
+        performanceHud->beginInput();
+        model->selectRect(QRect(selectionAnchor, pixel).normalized());
+    }
+}
+
+/**
+ * @brief SpriteEditorView::finishPendingStroke
+ * Draws every pixel queued for the stroke in progress, if any, and swaps it into the frame
+ * at once rather than when the worker next reports. Used by input replay, so that the time
+ * of each input covers the drawing and repaint it caused.
+ */
+void SpriteEditorView::finishPendingStroke()
+{
+    if (!toggleDraw)
+        return;
+    strokeRenderer->flush();
+    swapInStroke();
+}
+
+/**
+ * @brief SpriteEditorView::canvasReleased
+ * On a mouse release, all canvas drawing, moving, and selecting is stopped. The rest of the
+ * stroke is drawn and swapped in before its edit is recorded. A moved selection keeps
+ * floating until it is placed, so it can still be nudged or taken to another frame.
+ */
+void SpriteEditorView::canvasReleased()
+{
+    if (toggleDraw)
+    {
+        strokeRenderer->flush();
+        swapInStroke();
+        strokeRenderer->endStroke();
+        model->endEdit();
+        toggleDraw = false;
+    }
+    movingSelection = false;
+    selectingRect = false;
+}
+
+// ===================================================
+// ===                DRAWING TOOLS                ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorView::handlePenPress
+ * On a pen button click, the model sets the current tool
+ * to pen and the pen/eraser buttons' visual appearances are
+ * changed.
+ */
+void SpriteEditorView::onPenClick()
+{
+    model->setTool(SpriteEditorModel::PEN);
+    ui->penButton->setDisabled(true);
+    ui->eraserButton->setDisabled(false);
+}
+
+/**
+ * @brief SpriteEditorView::paletteColorClicked
+ * On a click on a document palette swatch, its color becomes the pen color, just as if
+ * it had been picked in the color picker.
+ *
+ * @param index -- the index of the clicked swatch
+ */
+void SpriteEditorView::paletteColorClicked(const QModelIndex& index)
+{
+    model->updateRecentColorsList(QColor::fromRgba(paletteListModel->getColor(index)));
+    onPenClick();
+}
+
+/**
+ * @brief SpriteEditorView::handleEraserPress
+ * On an eraser button click, the model sets the current tool
+ * to eraser and the pen/eraser buttons' visual appearances are
+ * changed.
+ */
+void SpriteEditorView::onEraserClick()
+{
+    model->setTool(SpriteEditorModel::ERASER);
+    ui->penButton->setDisabled(false);
+    ui->eraserButton->setDisabled(true);
+}
+
+/**
+ * @brief SpriteEditorView::onSelectToolClick
+ * On choosing a selection tool, the model sets it as the current tool, and both the
+ * pen and eraser buttons become available to switch back with.
+ *
+ * @param tool -- the selection tool chosen
+ */
+void SpriteEditorView::onSelectToolClick(SpriteEditorModel::Tool tool)
+{
+    model->setTool(tool);
+    ui->penButton->setDisabled(false);
+    ui->eraserButton->setDisabled(false);
+}
+
+
+// ===================================================
+// ===                  CLIPBOARD                  ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorView::cutClicked
+ * Copies the selected pixels to the clipboard, then makes them transparent.
+ */
+void SpriteEditorView::cutClicked()
+{
+    if (!model->hasSelection())
+        return;
+
+    copyClicked();
+    model->deleteSelection();
+}
+
+/**
+ * @brief SpriteEditorView::copyClicked
+ * Copies the selected pixels to the clipboard.
+ */
+void SpriteEditorView::copyClicked()
+{
+    QImage copied = model->copySelection();
+    if (copied.isNull())
+        return;
+
+    QGuiApplication::clipboard()->setImage(copied);
+    ui->statusbar->showMessage(QString("Copied %1 x %2 pixels").arg(copied.width()).arg(copied.height()), 2000);
+}
+
+/**
+ * @brief SpriteEditorView::pasteClicked
+ * Floats the clipboard's image over the current frame, at the top-left of the selection
+ * if there is one, and switches to the rectangle select tool so that it can be moved into place.
+ */
+void SpriteEditorView::pasteClicked()
+{
+    QImage pasted = QGuiApplication::clipboard()->image();
+    if (pasted.isNull())
+    {
+        ui->statusbar->showMessage("The clipboard holds no image", 2000);
+        return;
+    }
+
+    QPoint topLeft = model->hasSelection() ? model->getSelectionRect().topLeft() : QPoint(0, 0);
+    model->pasteImage(pasted, topLeft);
+    onSelectToolClick(SpriteEditorModel::RECTANGLE_SELECT);
+}
+
+
+// ===================================================
+// ===               PERFORMANCE HUD               ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorView::updatePerformanceHudMemory
+ * Reports the memory held by the frames, the undo/redo stacks, and every cache the model
+ * knows of to the performance HUD, along with the memory budget.
+ */
+void SpriteEditorView::updatePerformanceHudMemory()
+{
+    SpriteEditorModel::MemoryUsage usage = model->getMemoryUsage();
+    performanceHud->setMemoryUsage(usage.frameBytes, usage.historyBytes,
+                                   usage.totalBytes - usage.frameBytes - usage.historyBytes,
+                                   model->getMemoryBudget());
+}
+
+/**
+ * @brief SpriteEditorView::setMemoryBudgetClicked
+ * Prompts the user for a memory budget, then sets it.
+ */
+void SpriteEditorView::setMemoryBudgetClicked()
+{
+    bool ok;
+    int budgetMegabytes = QInputDialog::getInt(
+                this, "Sprite Editor", "Memory budget in MB (0 for none):",
+                model->getMemoryBudget() / (1024 * 1024), 0, MAX_MEMORY_BUDGET_MB, 1, &ok);
+    if (!ok)
+        return;
+
+    model->setMemoryBudget(budgetMegabytes * qint64(1024 * 1024));
+}
+
+/**
+ * @brief SpriteEditorView::reportMemoryBudgetExceeded
+ * Tells the user that memory was freed to meet the budget, and how much, or that the
+ * frames alone don't fit in it.
+ *
+ * @param bytesBefore -- the bytes the document held when it went over budget
+ * @param bytesAfter -- the bytes it holds after caches and history were dropped
+ * @param budget -- the memory budget in bytes
+ */
+void SpriteEditorView::reportMemoryBudgetExceeded(qint64 bytesBefore, qint64 bytesAfter, qint64 budget)
+{
+    double megabyte = 1024 * 1024;
+    QString message;
+    if (bytesAfter > budget)
+        message = QString("Memory budget of %1 MB exceeded (%2 MB); the frames alone don't fit in it.")
+                      .arg(budget / megabyte, 0, 'f', 1)
+                      .arg(bytesAfter / megabyte, 0, 'f', 1);
+    else
+        message = QString("Memory budget of %1 MB exceeded (%2 MB); freed caches and history down to %3 MB.")
+                      .arg(budget / megabyte, 0, 'f', 1)
+                      .arg(bytesBefore / megabyte, 0, 'f', 1)
+                      .arg(bytesAfter / megabyte, 0, 'f', 1);
+    ui->statusbar->showMessage(message, 5000);
+}
+
+
+// ===================================================
+// ===                PREVIEW FRAME                ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorView::displayPreviewFrame
+ * Displays a frame given from the model in the preview window.
+ *
+ * @param previewFrame -- the frame to display
+ */
+void SpriteEditorView::displayPreviewFrame(QImage *previewFrame)
+{
+    TRACE_SCOPE("displayPreviewFrame");
+    performanceHud->recordPreviewFrame();
+
+    // If the toggle to show true sprite size is checked, don't scale the canvas
+    if(ui->sizeToggle->isChecked())
+    {
+        QImage canvasBackground(ui->previewBackground->width(), ui->previewBackground->width(), QImage::Format_RGB32);
+        canvasBackground.fill(qRgb(255,255,255));
+        ui->previewBackground->setPixmap(QPixmap::fromImage(canvasBackground));
+        ui->previewLabel->setPixmap(QPixmap::fromImage(*previewFrame));
+    }
+    else
+    {
+        setCanvasBackground(ui->previewBackground);
+        QImage scaledCanvas = previewFrame->scaledToWidth(ui->previewLabel->width(), Qt::FastTransformation);
+        ui->previewLabel->setPixmap(QPixmap::fromImage(scaledCanvas));
+    }
+}
+
+/**
+ * @brief SpriteEditorView::resetPreview
+ * Resets the preview pane and controls. The FPS slider is reset to 0, the start button
+ * is paused, and the first frame is shown in the display preview.
+ */
+void SpriteEditorView::resetPreview()
+{
+    ui->fpsSlider->setValue(0);
+    ui->animationStartButton->setText(QString("▶"));
+    ui->animationStartButton->setStyleSheet("QPushButton {color: #32CD32};");
+    displayPreviewFrame(model->getFrame(0));
+}
+
+
+// ===================================================
+// ===             FRAME MANIPULATION              ===
+// ===================================================
+
+/**
+ * @brief SpriteEditorView::setCanvasBackground
+ * Sets the background of the canvas to a checkerboard grid.
+ */
+void SpriteEditorView::setCanvasBackground(QLabel *background)
+{
+    // Create the default canvas with the default size (in pixels), setting the background to
+    // be visible with a white/grey checkerboard pattern. Squares smaller than a screen pixel
+    // can't be seen, so large canvases get no more squares than the background is wide.
+    int squares = qMin(model->getCanvasSize(), background->width());
+    QImage canvasBackground(squares, squares, QImage::Format_RGB32);
+
+    for(int i = 0; i < squares; i++)
+    {
+        for(int j = 0; j < squares; j++)
+        {
+            if((i + j) % 2 == 0)
+                canvasBackground.setPixel(i, j, qRgb(230, 230, 230));
+            else
+                canvasBackground.setPixel(i, j, qRgb(255, 255, 255));
+        }
+    }
+
+    // Set up the canvas background
+    QImage scaledBackground = canvasBackground.scaledToWidth(background->width(), Qt::FastTransformation);
+    background->setPixmap(QPixmap::fromImage(scaledBackground));
+}
+
+/**
+ * @brief SpriteEditorView::setUpNewFrame
+ * When called, this helper method will set the current frame to be filled with blank color.
+ * The model then signals for the frame to be redrawn.
+ */
+void SpriteEditorView::setUpNewFrame()
+{
+    model->clearCurrentFrame();
+}
+
+/**
+ * @brief SpriteEditorView::refreshSelectedFrame
+ * This is a helper method/slot that takes the current frame and updates the pixmap to show current changes.
+ */
+void SpriteEditorView::refreshFrame(int frameIndex)
+{
+    TRACE_SCOPE("refreshFrame");
+
+    // The frame list refreshes its own thumbnail. If the frame being updated is the currently selected one,
+    // then the drawing canvas needs to be updated as well.
+    if (frameIndex == model->getCurrentFrameIndex())
+        updateCanvas(frameIndex);
+}
+
+/**
+ * @brief SpriteEditorView::updateCanvas
+ * Redraws the drawing canvas using the frame associated with the given frame index.
+ *
+ * @param frameIndex -- the index of the frame to display in the drawing canvas
+ */
+void SpriteEditorView::updateCanvas(int frameIndex)
+{
+    TRACE_SCOPE("updateCanvas");
+
+    ui->canvas->showFrame(frameIndex);
+}
+
+/**
+ * @brief SpriteEditorView::focusFrame
+ * Shows the frame with the given index in the drawing canvas, and selects it in the frame list.
+ *
+ * @param frameIndex -- the index of the newly focused frame
+ */
+void SpriteEditorView::focusFrame(int frameIndex)
+{
+    // Keep a multi-frame selection intact when focusing one of its frames.
+    QModelIndex index = frameListModel->index(frameIndex);
+    QItemSelectionModel* selection = ui->frameList->selectionModel();
+    selection->setCurrentIndex(index, selection->isSelected(index) ? QItemSelectionModel::NoUpdate
+                                                                   : QItemSelectionModel::ClearAndSelect);
+    updateCanvas(frameIndex);
+}
+
+/**
+ * @brief SpriteEditorView::getSelectedFrameIndices
+ *
+ * @return the indices of the frames selected in the frame list in ascending order,
+ *         or just the current frame if none are selected
+ */
+QList<int> SpriteEditorView::getSelectedFrameIndices()
+{
+    QList<int> frameIndices;
+    for (const QModelIndex& index : ui->frameList->selectionModel()->selectedRows())
+        frameIndices.append(index.row());
+
+    if (frameIndices.isEmpty())
+        frameIndices.append(model->getCurrentFrameIndex());
+    std::sort(frameIndices.begin(), frameIndices.end());
+    return frameIndices;
+}
+
+/**
+ * @brief SpriteEditorView::shiftFramesClicked
+ * Prompts the user for how far to shift the selected frames, then shifts them.
+ */
+void SpriteEditorView::shiftFramesClicked()
+{
+    bool ok;
+    int canvasSize = model->getCanvasSize();
+    int dx = QInputDialog::getInt(
+                this, "Sprite Editor", "Pixels to shift right (negative shifts left):", 0, -canvasSize, canvasSize, 1, &ok);
+    if (!ok)
+        return;
+    int dy = QInputDialog::getInt(
+                this, "Sprite Editor", "Pixels to shift down (negative shifts up):", 0, -canvasSize, canvasSize, 1, &ok);
+    if (!ok)
+        return;
+
+    model->shiftFrames(getSelectedFrameIndices(), dx, dy);
+}
+
+/**
+ * @brief SpriteEditorView::setFrameDurationClicked
+ * Prompts the user for how many animation ticks to hold the selected frames for, then sets it.
+ */
+void SpriteEditorView::setFrameDurationClicked()
+{
+    QList<int> frameIndices = getSelectedFrameIndices();
+    bool ok;
+    int duration = QInputDialog::getInt(
+                this, "Sprite Editor", "Ticks to hold each frame for:",
+                model->getFrameDuration(frameIndices.first()), 1, MAX_FRAME_DURATION, 1, &ok);
+    if (!ok)
+        return;
+
+    model->setFrameDurations(frameIndices, duration);
+}
+
+/**
+ * @brief SpriteEditorView::promptForColorReplacement
+ * Prompts the user for a color to replace and its replacement.
+ *
+ * @param colorMap -- receives the color to replace, mapped to its replacement
+ * @return true if the user chose both colors, false if they cancelled
+ */
+bool SpriteEditorView::promptForColorReplacement(QHash<QRgb, QRgb>& colorMap)
+{
+    QColor oldColor = QColorDialog::getColor(model->getCurrentColor(), this, "Color to Replace",
+                                             QColorDialog::ShowAlphaChannel);
+    if (!oldColor.isValid())
+        return false;
+    QColor newColor = QColorDialog::getColor(oldColor, this, "Replacement Color",
+                                             QColorDialog::ShowAlphaChannel);
+    if (!newColor.isValid())
+        return false;
+
+    colorMap.insert(oldColor.rgba(), newColor.rgba());
+    return true;
+}
+
+/**
+ * @brief SpriteEditorView::swapPaletteClicked
+ * Prompts the user for a color to replace and its replacement, then recolors the selected frames.
+ */
+void SpriteEditorView::swapPaletteClicked()
+{
+    QHash<QRgb, QRgb> colorMap;
+    if (promptForColorReplacement(colorMap))
+        model->swapPalette(getSelectedFrameIndices(), colorMap);
+}
+
+/**
+ * @brief SpriteEditorView::replaceColorEverywhereClicked
+ * Prompts the user for a color to replace and its replacement, then recolors every frame.
+ */
+void SpriteEditorView::replaceColorEverywhereClicked()
+{
+    QHash<QRgb, QRgb> colorMap;
+    if (promptForColorReplacement(colorMap))
+        model->replaceColors(colorMap);
+}
+
+/**
+ * @brief SpriteEditorView::reduceColorsClicked
+ * Prompts the user for a color budget and whether to dither, then reduces every frame
+ * to that many colors and shows the resulting palette.
+ */
+void SpriteEditorView::reduceColorsClicked()
+{
+    bool ok;
+    int maxColors = QInputDialog::getInt(
+                this, "Sprite Editor", "Number of colors to keep:", DEFAULT_COLOR_BUDGET, 2, 256, 1, &ok);
+    if (!ok)
+        return;
+    QStringList ditherOptions{"No dithering", "Ordered dithering"};
+    QString ditherOption = QInputDialog::getItem(this, "Sprite Editor", "Dithering:", ditherOptions, 0, false, &ok);
+    if (!ok)
+        return;
+
+    QList<QRgb> palette = model->reduceColors(maxColors, ditherOption == ditherOptions[1]);
+
+    paletteDock->show();
+    paletteDock->raise();
+    ui->statusbar->showMessage(QString("Reduced to a palette of %1 colors").arg(palette.count()), 5000);
+}
+
+/**
+ * @brief SpriteEditorView::clearCurrentFrame
+ * This slot fills the current frame with empty/clear pixels, effectively clearing it.
+ * The model keeps its color counts up to date and signals for the frame to be redrawn.
+ */
+void SpriteEditorView::clearCurrentFrame()
+{
+    model->clearCurrentFrame();
+}
+
+/**
+ * @brief SpriteEditorView::warnAboutClearFrame
+ * Displays the warning about Clear Frame removing edits and takes appropriate action
+ * based on the user's response.
+ */
+void SpriteEditorView::warnAboutClearFrame()
+{
+    QMessageBox msgbox;
+    msgbox.setWindowTitle("WARNING");
+    msgbox.setIcon(QMessageBox::Warning);
+    msgbox.setText("Warning! This will clear all edit history for this frame.\n\nContinue?");
+    msgbox.setStandardButtons(QMessageBox::Yes|QMessageBox::Cancel);
+    msgbox.setDefaultButton(QMessageBox::Cancel);
+
+    // If the user selects "Yes", then the frame is cleared.
+    if(msgbox.exec() == QMessageBox::Yes)
+    {
+        clearCurrentFrame();
+        model->clearEditsOnCurrentFrame();
+    }
+}
+
+/**
+ * @brief SpriteEditorView::warnAboutDeletion
+ * If the animation of the preview frame is running, prevent the user from
+ * deleting any frames. Deleting a frame with the animation running easily creates
+ * index out of bounds errors.
+ */
+void SpriteEditorView::warnAboutDeletion()
+{
+    QMessageBox msgbox;
+    msgbox.setWindowTitle("WARNING");
+    msgbox.setIcon(QMessageBox::Warning);
+    msgbox.setText("Warning! You cannot delete a frame while the animation is running.");
+    msgbox.setStandardButtons(QMessageBox::Cancel);
+    msgbox.setDefaultButton(QMessageBox::Cancel);
+    msgbox.exec();
+}
@@ -0,0 +1,143 @@
+/*
+ * Team             |   Chandler
+ * Members          |   Braden Fiedel, Caden Erickson, Connor Blood, Josie Fiedel
+ * Class            |   CS 3505
+ * Project          |   A7: Sprite Editor Implementation
+ * Last modified    |   April 5, 2023
+ * Style Reviewer   |   Josie Fiedel
+ *
+ * This file contains the class definition for the SpriteEditorView class.
+ */
+
+
+#ifndef SPRITEEDITORVIEW_H
+#define SPRITEEDITORVIEW_H
+
+#include "canvaswidget.h"
+#include "framelistmodel.h"
+#include "inputrecorder.h"
+#include "palettelistmodel.h"
+#include "performancehud.h"
+#include "spriteeditormodel.h"
+#include "strokerenderer.h"
+#include <QDockWidget>
+#include <QFileDialog>
+#include <QInputDialog>
+#include <QImage>
+#include <QMainWindow>
+#include <QProgressDialog>
+#include <QShortcut>
+#include <QLabel>
+
+QT_BEGIN_NAMESPACE
+namespace Ui { class SpriteEditorView; }
+QT_END_NAMESPACE
+
+/**
+ * @brief The SpriteEditorView class. This class represents the UI/View of the Sprite Editor program.
+ */
+class SpriteEditorView : public QMainWindow
+{
+    Q_OBJECT
+    friend class SpriteEditorBenchmarks;
+
+public:
+    SpriteEditorView(SpriteEditorModel& modelParam, QWidget *parent = nullptr);
+    ~SpriteEditorView();
+
+    void finishPendingStroke();
+
+private:
+    SpriteEditorModel* model;
+
+    Ui::SpriteEditorView* ui;
+    bool toggleDraw = false;
+    bool movingSelection = false;
+    bool selectingRect = false;
+    QPoint selectionAnchor;
+
+    const int THUMBNAIL_SIZE = 85;
+    const int MAX_CANVAS_SIZE = 4096;
+    FrameListModel* frameListModel;
+
+    QProgressDialog* fileProgressDialog;
+    bool openingFile = false;
+    const int FILE_PROGRESS_DELAY = 500;
+
+    const int SWATCH_SIZE = 20;
+    const int DEFAULT_COLOR_BUDGET = 16;
+    const int MAX_FRAME_DURATION = 999;
+    PaletteListModel* paletteListModel;
+    QDockWidget* paletteDock;
+
+    PerformanceHud* performanceHud;
+    InputRecorder* inputRecorder;
+    void updatePerformanceHudMemory();
+    const int MAX_MEMORY_BUDGET_MB = 65536;
+
+    QShortcut undoShortcut;
+    QShortcut redoShortcut;
+    QShortcut newShortcut;
+    QShortcut openShortcut;
+    QShortcut saveShortcut;
+    QShortcut saveAsShortcut;
+
+    StrokeRenderer* strokeRenderer;
+    void swapInStroke();
+
+    void setUpNewFrame();
+    void redrawCurrentFrame();
+    QList<int> getSelectedFrameIndices();
+    bool promptForColorReplacement(QHash<QRgb, QRgb>&);
+
+    void onPenClick();
+    void onEraserClick();
+    void onSelectToolClick(SpriteEditorModel::Tool);
+
+public slots:
+    void saveAsClicked();
+    void openClicked();
+    void newClicked();
+    void exportSpriteSheetClicked();
+    void importImageSequenceClicked();
+    void importSpriteSheetClicked();
+    void recordTraceToggled(bool);
+    void recordInputToggled(bool);
+    void setMemoryBudgetClicked();
+    void reportMemoryBudgetExceeded(qint64, qint64, qint64);
+    void exportAnimationClicked(SpriteEditorModel::AnimationFormat);
+    void showAnimationExportProgress(int, int);
+    void showAnimationExportResult(bool);
+    void showFileOperationStarted(QString, bool);
+    void showFileOperationProgress(int);
+    void showFileOperationResult(bool);
+    void showFrameLoading(bool);
+
+    void setCanvasBackground(QLabel*);
+    void updateCanvas(int);
+    void focusFrame(int);
+
+    void clearCurrentFrame();
+    void refreshFrame(int);
+
+    void displayPreviewFrame(QImage*);
+    void resetPreview();
+
+private slots:
+    void canvasPressed(QPoint);
+    void canvasDragged(QPoint);
+    void canvasReleased();
+    void paletteColorClicked(const QModelIndex&);
+    void cutClicked();
+    void copyClicked();
+    void pasteClicked();
+    void shiftFramesClicked();
+    void setFrameDurationClicked();
+    void swapPaletteClicked();
+    void replaceColorEverywhereClicked();
+    void reduceColorsClicked();
+    void warnAboutClearFrame();
+    void warnAboutDeletion();
+};
+
+#endif // SPRITEEDITORVIEW_H